@@ -0,0 +1,123 @@
+/**
+ * @file    Autotuner.h
+ * @author      Group 11
+ * @date        October 2026
+ * @version     0.3
+ *
+ * @brief This file contains the autotuner choosing the number of threads and
+ * the tile size of a simulation.
+*/
+
+#ifndef GAMEOFLIFE_AUTOTUNER_H
+#define GAMEOFLIFE_AUTOTUNER_H
+
+#include <string>
+#include <vector>
+#include "Cell_Culture/Population.h"
+
+using namespace std;
+
+/// @brief File the choices of the autotuner are kept in, in the working directory.
+const string AUTOTUNE_CACHE_FILE = "gol_autotune.cache";
+
+/// @brief Generations timed for each candidate, after one to warm up.
+const int AUTOTUNE_GENERATIONS = 8;
+
+/**
+ * @brief Data structure holding a thread count and tile size to simulate with.
+ */
+struct TuningChoice {
+  int threads;   ///< threads calculating the generations
+  int tileSize;  ///< largest width and height of the tiles
+};
+
+/**
+ * @brief Chooses the fastest thread count and tile size for a simulation.
+ *
+ * @details Every candidate thread count is tried with every candidate tile
+ * size, by calculating a few generations of a population made from the same
+ * world and rules. The candidate with the shortest time is chosen. Choices are
+ * kept in a cache file, one line per rules, world size and CPU model, so later
+ * runs with the same key skip the calibration. A cache file that can not be
+ * read or written is treated as empty.
+ */
+class Autotuner {
+ private:
+  WorldSettings world;       ///< world of the simulation
+  string evenRuleName;       ///< rule of the even generations
+  string oddRuleName;        ///< rule of the odd generations
+  string ruleMapFileName;    ///< rule map file, empty for none
+  string cacheFileName;      ///< file the choices are kept in
+  vector<int> threadCandidates;  ///< thread counts to try
+  vector<int> tileCandidates;    ///< tile sizes to try
+  bool calibrated;           ///< if the last choice was calibrated
+
+  /**
+   * @brief The key of the simulation in the cache file
+   * @return string rules, world size and CPU model, separated by tabs
+   */
+  string getCacheKey();
+
+  /**
+   * @brief Looks for the key in the cache file
+   * @param key key of the simulation
+   * @param choice set to the cached choice if found
+   * @return bool true if the key was found
+   */
+  bool readCache(const string &key, TuningChoice &choice);
+
+  /**
+   * @brief Keeps the choice in the cache file, replacing an earlier choice
+   * for the same key
+   * @param key key of the simulation
+   * @param choice the choice to keep
+   */
+  void writeCache(const string &key, const TuningChoice &choice);
+
+  /**
+   * @brief Times the calibration generations of a candidate
+   * @param candidate threads and tile size to try
+   * @return double seconds for AUTOTUNE_GENERATIONS generations
+   */
+  double timeCandidate(const TuningChoice &candidate);
+
+ public:
+  /**
+   * @brief Constructor
+   * @details The candidates are 1, 2, 4 and so on up to the CPUs of the
+   * machine, and tiles of 8, 16, 32 and 64 cells.
+   * @param world size, file, seed and share of alive cells of the world
+   * @param evenRuleName rule of the even generations
+   * @param oddRuleName rule of the odd generations, empty for the even rule
+   * @param ruleMapFileName rule map file, empty for none
+   * @param cacheFileName file the choices are kept in
+   */
+  Autotuner(const WorldSettings &world, const string &evenRuleName,
+            const string &oddRuleName, const string &ruleMapFileName,
+            const string &cacheFileName = AUTOTUNE_CACHE_FILE);
+
+  /**
+   * @brief Replaces the candidates to try
+   * @param threads thread counts to try
+   * @param tileSizes tile sizes to try
+   */
+  void setCandidates(const vector<int> &threads, const vector<int> &tileSizes);
+
+  /**
+   * @brief Chooses the thread count and tile size
+   * @details Uses the cached choice when there is one, otherwise calibrates
+   * every candidate and caches the fastest.
+   * @test That the choice is one of the candidates
+   * @test That a second autotuner uses the cached choice
+   * @return TuningChoice the fastest thread count and tile size
+   */
+  TuningChoice tune();
+
+  /**
+   * @brief If the last choice was calibrated rather than read from the cache
+   * @return bool true if calibrated
+   */
+  bool wasCalibrated() { return calibrated; }
+};
+
+#endif //GAMEOFLIFE_AUTOTUNER_H
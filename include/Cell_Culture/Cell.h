@@ -200,6 +200,13 @@ public:
      */
     void setNextColor(COLOR nextColor) { this->nextUpdate.nextColor = nextColor; }
 
+    /**
+     * @brief Get function for the color to be used the next iteration
+     *
+     * @return COLOR the color set with setNextColor
+     */
+    COLOR getNextColor() { return nextUpdate.nextColor; }
+
     /**
      * @brief Get function for the character that should represent the cell
      *
@@ -231,6 +238,13 @@ public:
      */
     void setNextCellValue(char value) { nextUpdate.nextValue = value; }
 
+    /**
+     * @brief Get function for the value to be used the next iteration
+     *
+     * @return char the value set with setNextCellValue
+     */
+    char getNextCellValue() { return nextUpdate.nextValue; }
+
     /**
      * @brief Set the is alive flag for the next iteration.
      *
@@ -0,0 +1,71 @@
+/**
+ * @file    Frame.h
+ * @author      Group 11
+ * @date        October 2026
+ * @version     0.3
+ *
+ * @brief This file contains a snapshot of the cell population.
+*/
+
+#ifndef GAMEOFLIFE_FRAME_H
+#define GAMEOFLIFE_FRAME_H
+
+#include <vector>
+#include "Cell.h"
+
+using namespace std;
+
+/**
+ * @brief Data structure holding what the cells looked like at one
+ * generation.
+ *
+ * @details A frame is a copy of what is shown for each cell, so it can be
+ * presented while the population calculates the next generations. The cells
+ * are stored row by row, rim cells included, so the rim is the first and last
+ * row and column.
+ */
+struct Frame {
+  int generation;           ///< generation of the population for the frame
+  int width;                ///< number of columns, rim included
+  int height;               ///< number of rows, rim included
+  vector<char> values;      ///< value of each cell
+  vector<COLOR> colors;     ///< color of each cell
+  vector<unsigned char> alive;  ///< 1 for each alive cell, otherwise 0
+
+  /**
+   * @brief Index of a cell in the vectors of the frame
+   * @param column column of the cell, 0 is the rim
+   * @param row row of the cell, 0 is the rim
+   * @return size_t index of the cell
+   */
+  size_t index(int column, int row) const {
+    return static_cast<size_t>(row) * width + column;
+  }
+
+  /**
+   * @brief If a position is part of the rim
+   * @param column column of the cell
+   * @param row row of the cell
+   * @return bool true for the first and last row and column
+   */
+  bool isRim(int column, int row) const {
+    return column == 0 || row == 0 || column == width - 1 || row == height - 1;
+  }
+
+  /**
+   * @brief Checksum of which cells are alive, FNV-1a over alive
+   * @details Frames with the same size and alive cells have the same
+   * checksum, whatever their values and colors.
+   * @return unsigned long long the checksum
+   */
+  unsigned long long aliveChecksum() const {
+    unsigned long long hash = 14695981039346656037ULL;
+    for (unsigned char cell : alive) {
+      hash ^= cell;
+      hash *= 1099511628211ULL;
+    }
+    return hash;
+  }
+};
+
+#endif //GAMEOFLIFE_FRAME_H
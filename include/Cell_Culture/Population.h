@@ -20,14 +20,38 @@
 #ifndef POPULATION_H
 #define POPULATION_H
 
+#include <chrono>
 #include <map>
 #include <string>
 #include "Cell.h"
+#include "Frame.h"
+#include <vector>
 #include "GoL_Rules/RuleFactory.h"
+#include "GoL_Rules/RuleMap.h"
 #include "GoL_Rules/RuleOfExistence.h"
-#include "Support/Globals.h"
+#include "GoL_Rules/TwoStepKernel.h"
+#include "Support/ThreadPool.h"
+#include "Support/WorkStealingScheduler.h"
+#include "Support/GenerationSnapshots.h"
+#include "Support/CpuTopology.h"
+#include "Support/SupportStructures.h"
 
 using namespace std;
+
+/**
+ * @brief Data structure holding a tile of the world and the rules executed
+ * for it.
+ */
+struct RuleTile {
+  Region region;               ///< the cells of the tile, rim cells included
+  RuleOfExistence* evenRule;   ///< rule executed for even generations
+  RuleOfExistence* oddRule;    ///< rule executed for odd generations
+};
+
+/// @brief Default width and height of the tiles the world is split into.
+const int DEFAULT_TILE_SIZE = 16;
+/// @brief Rows of a random world filled from the same random stream.
+const int RANDOM_CHUNK_ROWS = 64;
 /**
  * @brief the population class holds information about each generation.
  * @details Population's main responsibility during execution is determining which
@@ -44,9 +68,50 @@ class Population {
   map<Point, Cell> cells;
   RuleOfExistence* evenRuleOfExistence;
   RuleOfExistence* oddRuleOfExistence;
+  int tileSize;
+  vector<RuleTile> ruleTiles;
+  map<string, RuleOfExistence*> mappedRules;  ///< rules created for the rule map
+  vector<RuleOfExistence*> evenRules;  ///< distinct rules of the even tiles
+  vector<RuleOfExistence*> oddRules;   ///< distinct rules of the odd tiles
+  int generationsPerSweep;      ///< generations asked for per sweep, 1 or 2
+  bool hasTwoStepKernels;       ///< if the rules could be composed
+  TwoStepKernel evenKernel;     ///< even rule followed by odd rule
+  TwoStepKernel oddKernel;      ///< odd rule followed by even rule
+  int threadCount;              ///< threads calculating the generations
+  ThreadPool* threadPool;       ///< pool used when threadCount > 1
+  vector<size_t> bandStarts;    ///< first tile of each band, and the end
+  vector<vector<Cell*>> tileCells;  ///< cells of each tile, for updating
+  size_t tileColumns;           ///< number of tiles in each row of tiles
+  vector<size_t> allTiles;      ///< index of every tile
+  vector<unsigned char> tileAlive;  ///< if a tile has alive cells
+  bool workStealing;            ///< if tiles are scheduled by work stealing
+  WorkStealingScheduler* scheduler;  ///< used with work stealing and threads
+  GenerationSnapshots* snapshots;  ///< published generations, if enabled
+  bool threadPinning;           ///< if the threads are pinned to NUMA nodes
+  bool cellsPlacementPending;   ///< if the cells should be moved to the workers
+  vector<WorkerPlacement> placements;  ///< CPU and node of each pinned thread
+  vector<unsigned long long> workerBytes;  ///< estimated cell bytes gone through
+  vector<double> workerSeconds;  ///< time spent on the cells
+  WorldSettings world;          ///< how the world is created, and its size
+  int slabFirstRow;             ///< first row of the tiles, see setRows
+  int slabLastRow;              ///< last row of the tiles, -1 for every row
 
   void randomizeCellCulture();
   void buildCellCultureFromFile();
+  void buildRuleTiles(const RuleMap& ruleMap);
+  void buildTwoStepKernels();
+  void calculateTwoGenerations();
+  void buildBands();
+  void buildTileCells();
+  vector<size_t> findActiveTiles(const vector<RuleOfExistence*>& rules);
+  void executeTiles(size_t firstTile, size_t lastTile);
+  void publishSnapshot();
+  void placeWorkers();
+  void placeCellsOnWorkers();
+  void countTraffic(int worker, size_t firstTile, size_t lastTile,
+                    const chrono::steady_clock::time_point& start);
+  RuleOfExistence* getMappedRule(const string& ruleName,
+                                 RuleOfExistence* defaultRule);
 
  public:
   /**
@@ -59,7 +124,20 @@ class Population {
   Population()
       : generation(0),
         evenRuleOfExistence(nullptr),
-        oddRuleOfExistence(nullptr) {}
+        oddRuleOfExistence(nullptr),
+        tileSize(DEFAULT_TILE_SIZE),
+        generationsPerSweep(1),
+        hasTwoStepKernels(false),
+        threadCount(1),
+        threadPool(nullptr),
+        tileColumns(0),
+        workStealing(false),
+        scheduler(nullptr),
+        snapshots(nullptr),
+        threadPinning(false),
+        cellsPlacementPending(false),
+        slabFirstRow(0),
+        slabLastRow(-1) {}
 
   ~Population();
 
@@ -83,43 +161,235 @@ class Population {
    */
   RuleOfExistence* getOddRule() { return oddRuleOfExistence; }
 
+  /**
+   * @brief test support function
+   * @details returns the tiles the rules are dispatched over
+   * @return vector of RuleTile, row by row
+   */
+  const vector<RuleTile>& getRuleTiles() { return ruleTiles; }
+
+  /**
+   * @brief Set the largest width and height of the tiles
+   * @details Must be called before initiatePopulation to have any effect.
+   * @param size tile width and height in cells, 0 or less for a single tile
+   */
+  void setTileSize(int size) { tileSize = size; }
+
+  /**
+   * @brief Set how the world is created
+   * @details Must be called before initiatePopulation to have any effect.
+   * The world is read from the file if there is one, otherwise a random
+   * world of the given dimensions is created. A random world is filled in
+   * chunks of RANDOM_CHUNK_ROWS rows, where each chunk draws from its own
+   * random stream derived from the seed and the chunk. The chunks are filled
+   * by the threads of setThreadCount if it was called before
+   * initiatePopulation, otherwise by the calling thread. The same seed gives
+   * the same world, whatever the number of threads.
+   * @test that the same seed gives the same world with different threads
+   * @test that the share of alive cells follows the density
+   * @param settings the file, or the dimensions, seed and share of alive
+   * cells
+   */
+  void setWorld(const WorldSettings& settings) { world = settings; }
+
+  /**
+   * @brief Set the rows of the world the population holds
+   * @details Must be called before initiatePopulation to have any effect.
+   * Only the cells of the rows from firstRow to lastRow, and of the row
+   * above and below them, are created, read from the file or drawn from the
+   * same random streams as the whole world. Only the given rows are split
+   * into tiles, the rows around them are a halo the rules read but do not
+   * calculate. Used to calculate a slab of a world on its own, see
+   * SlabSimulation.
+   * @test that only the rows and the halo are created, as in the whole world
+   * @param firstRow first row of the tiles, rim included
+   * @param lastRow last row of the tiles, rim included
+   */
+  void setRows(int firstRow, int lastRow) {
+    slabFirstRow = firstRow;
+    slabLastRow = lastRow;
+  }
+
+  /**
+   * @brief Get the width and height of the world, excluding the rim
+   * @details After initiatePopulation, the dimensions of the file if the
+   * world was read from one.
+   * @return Dimensions of the world
+   */
+  const Dimensions& getWorldDimensions() { return world.dimensions; }
+
+  /**
+   * @brief Set the number of threads calculating the generations
+   * @details The tiles are split into bands of whole tile rows, one band per
+   * thread. The threads first updates the cells of their bands, and when all
+   * are done, executes the rules for their tiles. Rules reads the cells
+   * around a tile from the neighbouring bands, but only writes the next
+   * state of the cells in their own tiles. The result is the same as with a
+   * single thread. The threads are kept until the thread count is changed.
+   * @test that the cells are the same as with one thread, for erik
+   * @param count number of threads, 1 or less calculates on the calling
+   * thread only
+   */
+  void setThreadCount(int count);
+
+  /**
+   * @brief Get the number of threads calculating the generations
+   * @return INT number of threads
+   */
+  int getThreadCount() { return threadCount; }
+
+  /**
+   * @brief Set if the tiles are scheduled by work stealing
+   * @details Used instead of bands when there is more than one thread. Each
+   * thread gets a queue of tiles and steals tiles from the others when its
+   * own queue is empty. Only active tiles are executed, tiles where no cell,
+   * and no cell in the tiles around it, is alive are skipped when the rules
+   * leaves such tiles unchanged. The result is the same as with a single
+   * thread.
+   * @test that the cells are the same as with one thread
+   * @param enabled true to use work stealing
+   */
+  void setWorkStealing(bool enabled);
+
+  /**
+   * @brief Get what each thread has done with work stealing
+   * @return vector of WorkerStats, one for each thread, empty without work
+   * stealing
+   */
+  vector<WorkerStats> getWorkerStats();
+
+  /**
+   * @brief Set if the threads are pinned to the CPUs of the NUMA nodes
+   * @details Neighbouring bands are placed on the same node, see
+   * CpuTopology::placeWorkers, and with work stealing the threads steals
+   * from their own node first. Before the next generation, the cells of each
+   * band are copied into the map by the thread owning the band, so the
+   * memory is first touched, and placed, on the node of that thread. The
+   * result is the same as without pinning.
+   * @test that the cells are the same as with one thread
+   * @param enabled true to pin the threads, needs more than one thread
+   */
+  void setThreadPinning(bool enabled);
+
+  /**
+   * @brief Get the cells each NUMA node has gone through
+   * @details Estimates the bytes of the cells updated and executed by the
+   * threads of each node from the number of cells, and measures the time
+   * they spent doing it. No memory counters are read.
+   * @return vector of NodeStats, one for each node, empty without pinning
+   */
+  vector<NodeStats> getNodeStats();
+
   /**
    * @brief initializes the cell culture and the concrete rules to be used in
    * the sim.
    * @details determines wheter the cell culture should be randomized or built
    * from file, creates the rules to be used, based on a specified rule name. If
-   * no odd rule is specified odd rule is set to even rule.
+   * no odd rule is specified odd rule is set to even rule. If a rule map file
+   * is given, the regions it covers uses the rules from the map instead. The
+   * world is split into tiles that each have a single pair of rules.
    * @param evenRuleName specifies rule name for evenRuleOfExistence
    * @param oddRuleName specifies rule name for oddRuleOfExistence
+   * @param ruleMapFileName file with rules for regions of the world, empty
+   * to use the even and odd rule everywhere
+   * @test That the tiles covered by the rule map uses the mapped rules
    * @test If oddRuleName is set to evenRuleName if no odd rule name is
    * specified.
    * @test If null/undefined/non-existent variable names are used for rulenames.
    * Should throw an exception
    * @bug no exception is thrown when a non-existent value is passed as input.
    */
-  void initiatePopulation(const string& evenRuleName, string oddRuleName = "");
+  void initiatePopulation(const string& evenRuleName, string oddRuleName = "",
+                          const string& ruleMapFileName = "");
 
   /**
    * @brief update the cell population and next generational changes based on
    * the rules
    * @details first the function calls each cell in turn and updates their state
    * until the entire cell population has been updated. Secondly it alternates
-   * between odd and even rulesets, based on the current generation.
+   * between odd and even rulesets, based on the current generation, executing
+   * the rules of each tile for the cells in that tile. Every rule used is
+   * told when the generation begins and ends, once per generation.
+   * When two generations per sweep is used, both generations are calculated
+   * by a composed kernel and generation is increased by 2.
+   * With more than one thread, the cells are updated and the rules executed
+   * in bands of tiles by the thread pool, see setThreadCount, or tile by
+   * tile with work stealing, see setWorkStealing.
    *
    * Test Recommendations
    * @test if generation has been updated after function has been called.
    * @test if generation is even or odd, the correct ruleofexistence should be
    * executed.
+   * @test that generation is increased by 2 with two generations per sweep.
    *
    * @bug wrong function name as the function updates and calculates.
    * @return INT generation prefix-incremented
    */
   int calculateNewGeneration();
 
+  /**
+   * @brief Updates the state of the cells of a range of tiles
+   * @details First half of calculateNewGeneration, for a part of the world
+   * calculated on its own, see SlabSimulation. Cells outside the tiles are
+   * not changed.
+   * @param firstTile first tile to update
+   * @param lastTile tile after the last one to update
+   */
+  void updateTiles(size_t firstTile, size_t lastTile);
+
+  /**
+   * @brief Executes the rules of the generation for a range of tiles
+   * @details Second half of calculateNewGeneration, after updateTiles. The
+   * rules are told when the generation begins and ends as usual.
+   * @test that slabs calculated on their own gives the same cells
+   * @param firstTile first tile to execute the rules for
+   * @param lastTile tile after the last one to execute the rules for
+   * @return INT generation prefix-incremented
+   */
+  int executeRulesForTiles(size_t firstTile, size_t lastTile);
+
+  /**
+   * @brief If every rule only reads the cells next to the cell it decides
+   * @details True when every rule can be described by a step table. Such
+   * rules keep no state across the world, like the erik prime elder, so
+   * parts of the world can be calculated on their own given the rows
+   * around them.
+   * @return bool true if the rules only read the neighbouring cells
+   */
+  bool hasLocalRules();
+
+  /**
+   * @brief Sets the generation, for cells calculated somewhere else
+   * @param newGeneration the generation the cells are at
+   */
+  void setGeneration(int newGeneration) { generation = newGeneration; }
+
+  /**
+   * @brief Sets how many generations each call to calculateNewGeneration
+   * advances
+   * @details With 2, the even and odd rule are composed into one kernel
+   * that advances two generations in a single sweep over the world. This is
+   * only possible when the whole world uses one even and one odd rule, and
+   * both rules can be described by a step table, otherwise one generation is
+   * calculated per sweep.
+   * @test that rules without step tables, such as erik, uses 1
+   * @param generations generations per sweep, 1 or 2
+   */
+  void setGenerationsPerSweep(int generations);
+
+  /**
+   * @brief Get the number of generations each sweep advances
+   * @return INT 2 if the rules are composed, otherwise 1
+   */
+  int getGenerationsPerSweep() {
+    return (generationsPerSweep == 2 && hasTwoStepKernels) ? 2 : 1;
+  }
+
   /**
    * @brief Returns cell by specified key value.
    * @details Uses Point object position to return the cell at that current
-   * position
+   * position. The cell is changed by calculateNewGeneration, other threads
+   * should read the cells through pinGeneration instead.
    * @test check that the function returns the correct value
    * @param position holding the current position of a specified point.
    * @return CELL map object.
@@ -134,6 +404,35 @@ class Population {
    * @return INT size of population object.
    */
   int getTotalCellPopulation() { return cells.size(); }
+
+  /**
+   * @brief Copies what is shown for each cell into a frame
+   * @details The vectors of the frame are reused, so taking snapshots into
+   * the same frame does not allocate memory once it has the right size.
+   * @test that the frame holds the value, color and state of the cells
+   * @param frame set to the current generation and cells
+   */
+  void takeSnapshot(Frame& frame);
+
+  /**
+   * @brief Publish a snapshot of every new generation that readers can pin
+   * @details Each generation is copied once into a buffer that no reader
+   * has pinned, readers then share it without copying. When all buffers are
+   * pinned the generation is not published, the simulation never waits for
+   * the readers. The current generation is published directly.
+   * @param buffers number of buffers, the current generation and the ones
+   * readers hold at the same time
+   */
+  void enableSnapshots(int buffers);
+
+  /**
+   * @brief Pin the newest published generation
+   * @details May be called from any thread. The frame is not changed until
+   * it is released, even though later generations are published.
+   * @test that a pinned generation is unchanged by later generations
+   * @return PinnedFrame the generation, empty if snapshots are not enabled
+   */
+  PinnedFrame pinGeneration();
 };
 
 #endif
\ No newline at end of file
@@ -0,0 +1,127 @@
+/**
+ * @file    DownsampledRenderer.h
+ * @author      Group 11
+ * @date        October 2026
+ * @version     0.3
+ *
+ * @brief This file contains the renderer showing a part of a world larger
+ * than the terminal, several cells per character.
+*/
+
+#ifndef GAMEOFLIFE_DOWNSAMPLEDRENDERER_H
+#define GAMEOFLIFE_DOWNSAMPLEDRENDERER_H
+
+#include <cstdint>
+#include <vector>
+#include "Cell_Culture/Frame.h"
+
+using namespace std;
+
+/**
+ * @brief How the cells are shown on the terminal.
+ */
+enum class DownsampleMode {
+  CELLS,        ///< one character per cell, the value of the cell
+  HALF_BLOCKS,  ///< 1x2 dots per character, with half block characters
+  BRAILLE       ///< 2x4 dots per character, with Braille characters
+};
+
+/**
+ * @brief Data structure holding the part of the world that is shown.
+ */
+struct Viewport {
+  int column;  ///< first world column shown, 0 is the first after the rim
+  int row;     ///< first world row shown, 0 is the first after the rim
+  int zoom;    ///< width and height in cells of each dot, at least 1
+};
+
+/**
+ * @brief Renders the part of a frame inside a viewport as dots, several
+ * per character.
+ *
+ * @details Each dot covers zoom x zoom cells and is lit when at least a
+ * quarter of them are alive. The alive cells inside the viewport are packed
+ * into rows of 64 bit words, and the alive cells of a dot are counted with
+ * popcounts on the words. Only the cells inside the viewport are read, so the
+ * cost follows the size of the terminal and the zoom, not the world.
+ */
+class DownsampledRenderer {
+ private:
+  DownsampleMode mode;     ///< half blocks or Braille
+  Viewport viewport;       ///< the shown part of the world
+  int columns;             ///< characters per row
+  int rows;                ///< rows of characters
+  int bitColumns;          ///< cells per packed row
+  int bitRows;             ///< packed rows
+  int wordsPerRow;         ///< words per packed row
+  vector<uint64_t> bits;   ///< alive cells of the viewport, row by row
+  vector<uint32_t> glyphs; ///< code point of each character, row by row
+
+  /**
+   * @brief Packs the alive cells inside the viewport into bits
+   * @param frame the frame to render
+   */
+  void packViewport(const Frame &frame);
+
+  /**
+   * @brief Counts the alive cells of a dot
+   * @param dotColumn column of the dot
+   * @param dotRow row of the dot
+   * @return int alive cells, of zoom x zoom
+   */
+  int countAlive(int dotColumn, int dotRow) const;
+
+ public:
+  /**
+   * @brief Constructor
+   * @param mode HALF_BLOCKS or BRAILLE
+   * @param viewport the shown part of the world
+   * @param columns characters per row
+   * @param rows rows of characters
+   */
+  DownsampledRenderer(DownsampleMode mode, const Viewport &viewport,
+                      int columns, int rows);
+
+  /**
+   * @brief Renders the viewport of a frame
+   * @details Dots outside the world are not lit.
+   * @test That each dot of a Braille character follows its cell
+   * @test That half blocks shows the upper and lower cell
+   * @test That a zoomed dot is lit by a quarter of its cells
+   * @param frame the frame to render
+   * @return vector of Unicode code points, columns x rows, row by row
+   */
+  const vector<uint32_t> &render(const Frame &frame);
+
+  /**
+   * @brief Get the number of characters per row
+   * @return int characters per row
+   */
+  int getColumns() const { return columns; }
+
+  /**
+   * @brief Get the number of rows of characters
+   * @return int rows of characters
+   */
+  int getRows() const { return rows; }
+
+  /**
+   * @brief Dots per character horizontally
+   * @param mode HALF_BLOCKS or BRAILLE
+   * @return int 1 for half blocks, 2 for Braille
+   */
+  static int dotsWide(DownsampleMode mode) {
+    return mode == DownsampleMode::BRAILLE ? 2 : 1;
+  }
+
+  /**
+   * @brief Dots per character vertically
+   * @param mode HALF_BLOCKS or BRAILLE
+   * @return int 2 for half blocks, 4 for Braille
+   */
+  static int dotsHigh(DownsampleMode mode) {
+    return mode == DownsampleMode::BRAILLE ? 4 : 2;
+  }
+};
+
+#endif //GAMEOFLIFE_DOWNSAMPLEDRENDERER_H
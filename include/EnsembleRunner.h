@@ -0,0 +1,87 @@
+/**
+ * @file    EnsembleRunner.h
+ * @author      Group 11
+ * @date        October 2026
+ * @version     0.3
+ *
+ * @brief This file contains a runner simulating the same rules for many
+ * random seeds, without presenting them.
+*/
+
+#ifndef GAMEOFLIFE_ENSEMBLERUNNER_H
+#define GAMEOFLIFE_ENSEMBLERUNNER_H
+
+#include <string>
+#include <vector>
+#include "Cell_Culture/Population.h"
+
+using namespace std;
+
+/**
+ * @brief Data structure holding the outcome of the simulation of one seed.
+ */
+struct EnsembleResult {
+  unsigned int seed;            ///< seed of the random world
+  int stabilisationGeneration;  ///< first generation of the repeating
+                                ///< states, -1 if no state repeated
+  int finalPopulation;          ///< alive cells when the simulation ended
+  int period;                   ///< generations between the repeating
+                                ///< states, 1 for still lifes, 0 if none
+};
+
+/**
+ * @brief Simulates an independent population for each seed, spread over a
+ * pool of threads, and reports how each of them ended.
+ *
+ * @details Every population has its own random world, made from the world
+ * settings with the seed replaced, and is calculated by a single thread.
+ * After each generation the alive cells are hashed, and kept packed one bit
+ * per cell. When a hash has been seen before and the alive cells are the
+ * same, the population has stabilised: the generation they were first seen
+ * is the stabilisation generation and the distance between them the period.
+ * A population that has not stabilised within the maximum number of
+ * generations is stopped there.
+ */
+class EnsembleRunner {
+ private:
+  WorldSettings world;     ///< world of every population, except the seed
+  string evenRuleName;     ///< rule of the even generations
+  string oddRuleName;      ///< rule of the odd generations
+  string ruleMapFileName;  ///< rule map file, empty for none
+  int maxGenerations;      ///< generations to simulate at most
+  int threadCount;         ///< threads simulating the populations
+
+  /**
+   * @brief Simulates the population of one seed
+   * @param seed seed of the random world
+   * @return EnsembleResult how the population ended
+   */
+  EnsembleResult runSeed(unsigned int seed);
+
+ public:
+  /**
+   * @brief Constructor
+   * @param world size and live density of the worlds, the file is not used
+   * @param evenRuleName rule of the even generations
+   * @param oddRuleName rule of the odd generations, empty for the even rule
+   * @param ruleMapFileName rule map file, empty for none
+   * @param maxGenerations generations to simulate at most
+   * @param threadCount threads simulating the populations
+   */
+  EnsembleRunner(const WorldSettings &world, const string &evenRuleName,
+                 const string &oddRuleName, const string &ruleMapFileName,
+                 int maxGenerations, int threadCount);
+
+  /**
+   * @brief Simulates a population for each seed
+   * @details The seeds follows each other, from the seed of the world
+   * settings. The results only depend on the seeds, not on the threads.
+   * @test that the results are the same with one and several threads
+   * @test that an empty world is stable from the start
+   * @param seeds number of seeds
+   * @return vector of EnsembleResult, one for each seed, in seed order
+   */
+  vector<EnsembleResult> run(int seeds);
+};
+
+#endif //GAMEOFLIFE_ENSEMBLERUNNER_H
@@ -0,0 +1,158 @@
+/**
+ * @file    FrameStreamer.h
+ * @author      Group 11
+ * @date        October 2026
+ * @version     0.3
+ *
+ * @brief This file contains the class streaming raw frames to a pipe or file.
+*/
+
+#ifndef GAMEOFLIFE_FRAMESTREAMER_H
+#define GAMEOFLIFE_FRAMESTREAMER_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <sys/uio.h>
+#include "ImageExporter.h"
+
+using namespace std;
+
+/// @brief Bytes of the header written before the first frame.
+const int STREAM_HEADER_SIZE = 64;
+
+/// @brief Frame rate in the header when the frames are not paced.
+const double DEFAULT_STREAM_FPS = 30.0;
+
+/**
+ * @brief Pixel formats of the streamed frames.
+ */
+enum class PixelFormat {
+  RGB = 0,     ///< three bytes per pixel, red, green and blue
+  PALETTE = 1  ///< one byte per pixel, an index in the palette of the header
+};
+
+/**
+ * @brief Data structure holding what has been streamed.
+ */
+struct StreamStats {
+  unsigned long frames = 0;      ///< frames written
+  unsigned long long bytes = 0;  ///< bytes written, the header included
+  unsigned long writeCalls = 0;  ///< writev and vmsplice calls made
+  bool spliced = false;          ///< if the frames were given to a pipe
+  bool closed = false;           ///< if the reader closed the stream
+};
+
+/**
+ * @brief Streams the frames as raw pixels, for video encoders.
+ *
+ * @details The stream starts with a header of STREAM_HEADER_SIZE bytes,
+ * all numbers little endian:
+ *  - 0: "GOLRAW01"
+ *  - 8: width and height in pixels, rim excluded
+ *  - 16: frame rate as numerator and denominator
+ *  - 24: pixel format and bytes per frame
+ *  - 32: palette of 8 colors, red, green and blue, as COLOR_RGB
+ *  - 56: zeros
+ *
+ * The frames follow without anything in between, one pixel per cell with
+ * the color of the cell. Each frame is rendered into a buffer of its own,
+ * which is handed to the kernel without copying it: a pipe gets the pages
+ * with vmsplice, on Linux, and anything else gets them with writev. The
+ * pipe refers to the pages until the reader has read them, so there are
+ * enough buffers to fill the pipe before one is rendered again. A slow
+ * reader only blocks the thread writing the frames, the simulation skips
+ * frames meanwhile, as when the terminal is behind.
+ */
+class FrameStreamer {
+ private:
+  int fd;                       ///< file descriptor of the stream
+  bool ownsFd;                  ///< if fd is closed by the destructor
+  bool isPipe;                  ///< if fd is a pipe, given pages by vmsplice
+  PixelFormat format;           ///< pixel format of the frames
+  double framesPerSecond;       ///< frame rate in the header
+  vector<vector<unsigned char>> buffers;  ///< rendered frames, reused
+  size_t nextBuffer = 0;        ///< buffer of the next frame
+  StreamStats stats;            ///< what has been streamed
+
+  /**
+   * @brief Renders the cells of a frame as pixels
+   * @param frame the frame to render
+   * @param pixels set to the pixels, rim excluded
+   */
+  void render(const Frame &frame, vector<unsigned char> &pixels) const;
+
+  /**
+   * @brief Makes enough buffers to fill the pipe before one is reused
+   * @param frameBytes bytes of each frame
+   */
+  void allocateBuffers(size_t frameBytes);
+
+  /**
+   * @brief Writes every byte of the vectors with writev
+   * @param vectors the bytes to write, advanced past the written bytes
+   * @param count number of vectors
+   * @return bool false if the stream could not be written
+   */
+  bool writeVectors(iovec *vectors, int count);
+
+  /**
+   * @brief Gives the pages of a buffer to the pipe with vmsplice
+   * @details Falls back to writeVectors if the pipe does not take them.
+   * @param data the bytes to give
+   * @param size number of bytes
+   * @return bool false if the stream could not be written
+   */
+  bool splice(const unsigned char *data, size_t size);
+
+ public:
+  /**
+   * @brief Constructor, opens the stream
+   * @details "-" streams to the standard output. Opening a named pipe waits
+   * until it has a reader. Prints a message and throws ios_base::failure if
+   * the file can not be opened.
+   * @param path file or named pipe to stream to, "-" for the standard output
+   * @param format pixel format of the frames
+   * @param framesPerSecond frame rate in the header, 0 for DEFAULT_STREAM_FPS
+   */
+  FrameStreamer(const string &path, PixelFormat format, double framesPerSecond);
+
+  /**
+   * @brief Destructor, closes the stream if it was opened
+   */
+  ~FrameStreamer();
+
+  /// @brief The stream is not copied, it owns its file descriptor.
+  FrameStreamer(const FrameStreamer &) = delete;
+  /// @brief The stream is not copied, it owns its file descriptor.
+  FrameStreamer &operator=(const FrameStreamer &) = delete;
+
+  /**
+   * @brief Writes a frame, and the header before the first one
+   * @details Nothing more is written once the reader has closed the stream.
+   * Frames of another size than the first one are not written.
+   * @test That the header and the pixels are written
+   * @param frame the frame to write
+   */
+  void writeFrame(const Frame &frame);
+
+  /**
+   * @brief Get what has been streamed
+   * @return StreamStats frames, bytes and write calls
+   */
+  const StreamStats &getStats() const { return stats; }
+
+  /**
+   * @brief Makes the header of a stream
+   * @test That the numbers are little endian
+   * @param width pixels per row
+   * @param height rows of pixels
+   * @param format pixel format of the frames
+   * @param framesPerSecond frame rate
+   * @return string the STREAM_HEADER_SIZE bytes of the header
+   */
+  static string makeHeader(int width, int height, PixelFormat format,
+                           double framesPerSecond);
+};
+
+#endif  // GAMEOFLIFE_FRAMESTREAMER_H
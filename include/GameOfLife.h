@@ -15,7 +15,14 @@
 
 #include <string>
 #include "Cell_Culture/Population.h"
+#include "GenerationStream.h"
 #include "ScreenPrinter.h"
+#include "Support/Pacer.h"
+#include "ImageExporter.h"
+#include "FrameStreamer.h"
+
+/// @brief Number of frames passed between the simulation and printing.
+const int FRAME_RING_SIZE = 4;
 
 /**
 * @brief The heart of the simulation, interconnects the main execution with the
@@ -37,6 +44,15 @@ class GameOfLife {
                                  ///< singleton object
   int nrOfGenerations;  ///< int nrOfGeneraltions used as a counter for how many
                         ///< generations to run.
+  double framesPerSecond = 0.0;  ///< target frames printed per second, 0 for
+                                 ///< as fast as possible
+  double generationsPerSecond = 0.0;  ///< target generations calculated per
+                                      ///< second, 0 for as fast as possible
+  PacingStats pacingStats{0.0, 0.0};  ///< rates of the last runSimulation
+  ImageExporter* exporter = nullptr;  ///< writes generations as images,
+                                      ///< nullptr for none
+  FrameStreamer* streamer = nullptr;  ///< gets the frames instead of the
+                                      ///< screen, nullptr to print them
 
  public:
   /**
@@ -50,11 +66,19 @@ class GameOfLife {
    * generations
    * @param oddRuleName  std::string holding the ruleset used for odd
    * generations.
+   * @param ruleMapFileName std::string holding the name of a file with rules
+   * for regions of the world, empty for none.
+   * @param world size, file, seed and share of alive cells of the world.
+   * @param tileSize largest width and height of the tiles of the world.
+   * @param threadCount number of threads, also filling a random world.
    * @test if the constructor sets private nrOfGenerations correctly.
    * @test that even and odd rulenames has been initialized correctly.
    *
    */
-  GameOfLife(int nrOfGenerations, string evenRuleName, string oddRuleName);
+  GameOfLife(int nrOfGenerations, string evenRuleName, string oddRuleName,
+             const string& ruleMapFileName = "",
+             const WorldSettings& world = WorldSettings(),
+             int tileSize = DEFAULT_TILE_SIZE, int threadCount = 1);
 
   //---------------------------------------------------------------------------
   /**
@@ -78,12 +102,67 @@ class GameOfLife {
 
   //---------------------------------------------------------------------------
 
+  /**
+   * @brief Get the generations of the simulation as a pull based stream
+   * @details For programs embedding the simulation instead of running it
+   * with runSimulation. Nothing is printed, and a generation is only
+   * calculated when the consumer steps the stream.
+   * @test That the stream ends at nrOfGenerations
+   * @return GenerationStream of the population, until nrOfGenerations
+   */
+  GenerationStream generations() {
+    return GenerationStream(population, nrOfGenerations);
+  }
+
+  /**
+   * @brief Set the rates runSimulation is paced to
+   * @details Frames and generations are paced independently, so several
+   * generations can be calculated for each printed frame. Frames in between
+   * are not printed.
+   * @param framesPerSecond target frames printed per second, 0 for as fast
+   * as possible
+   * @param generationsPerSecond target generations calculated per second, 0
+   * for as fast as possible
+   */
+  void setPacing(double framesPerSecond, double generationsPerSecond) {
+    this->framesPerSecond = framesPerSecond;
+    this->generationsPerSecond = generationsPerSecond;
+  }
+
+  /**
+   * @brief Get the rates achieved by the last runSimulation
+   * @return PacingStats frames and generations per second
+   */
+  const PacingStats& getPacingStats() { return pacingStats; }
+
+  /**
+   * @brief Set where the generations are exported as images
+   * @details runSimulation and runHeadless offer every generation to the
+   * exporter from the thread calculating them, the exporter decides which
+   * are written.
+   * @param exporter the exporter, must outlive the runs, nullptr for none
+   */
+  void setExporter(ImageExporter* exporter) { this->exporter = exporter; }
+
+  /**
+   * @brief Set where runSimulation streams the frames instead of printing
+   * @details The frames are written by the calling thread, as when printed,
+   * so the simulation skips frames while the reader is behind.
+   * @param streamer the streamer, must outlive the runs, nullptr to print
+   */
+  void setStreamer(FrameStreamer* streamer) { this->streamer = streamer; }
+
   /**
    * @brief Run the Game of Life simulation
    * @details This function is called once and runs the simulation for as many
-   * generations as has been set by the used, or the default. For each
-   * iteration, the function calculates population changes and print the
-   * information to the screen.
+   * generations as has been set by the used, or the default. The population
+   * changes are calculated on a thread of their own, and each generation is
+   * published as a frame through a FrameRing. The calling thread prints the
+   * newest frame each time it is done printing, frames in between are
+   * dropped. With a streamer the frames are streamed instead of printed.
+   * The first and last generation are always printed. The threads sleep
+   * until the deadline of their next frame or generation, when rates have
+   * been set with setPacing.
    * @test Make sure no exception is thrown when running the simulation.
    * @test Make sure the appValue generation the same as nrOfGenerations after
    * running the function.
@@ -96,6 +175,20 @@ class GameOfLife {
    * the 0th generation not having any rules set for the 1st generation.
    */
   void runSimulation();
+
+  /**
+   * @brief Run the simulation without presenting it
+   * @details Calculates every generation on the calling thread as fast as
+   * possible, without frames, printing or pacing. Used for batch jobs and
+   * benchmarks. With two generations per sweep, an odd last generation is
+   * calculated with a sweep of one, so it stops at the last generation.
+   * @test That the checksum and population are the same as when stepping
+   * the generations
+   * @test That an odd last generation is not passed with two per sweep
+   * @return HeadlessStats generations, time, cells calculated and the
+   * checksum and alive cells of the last generation
+   */
+  HeadlessStats runHeadless();
 };
 
 #endif
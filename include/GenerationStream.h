@@ -0,0 +1,322 @@
+/**
+ * @file    GenerationStream.h
+ * @author      Group 11
+ * @date        October 2026
+ * @version     0.3
+ *
+ * @brief This file contains a pull based stream of the generations of a
+ * population, for programs embedding the simulation.
+*/
+
+#ifndef GAMEOFLIFE_GENERATIONSTREAM_H
+#define GAMEOFLIFE_GENERATIONSTREAM_H
+
+#include <cstddef>
+#include <exception>
+#include <iterator>
+#include <utility>
+#include "Cell_Culture/Population.h"
+
+#if defined(__cpp_impl_coroutine) && __cpp_impl_coroutine >= 201902L
+#include <coroutine>
+/// @brief Defined when generateGenerations is available.
+#define GAMEOFLIFE_HAS_COROUTINES 1
+#endif
+
+using namespace std;
+
+/**
+ * @brief Lightweight view of the generation a population is at.
+ *
+ * @details The view only refers to the population, nothing is copied. The
+ * cells are read from the population when asked for, and the view follows
+ * the population when it calculates new generations.
+ */
+class GenerationView {
+ private:
+  Population *population;  ///< the viewed population
+
+ public:
+  /**
+   * @brief Constructor
+   * @param population the viewed population, must outlive the view
+   */
+  explicit GenerationView(Population &population) : population(&population) {}
+
+  /**
+   * @brief Get the generation of the population
+   * @return int the generation, as in the frames of the population
+   */
+  int getGeneration() const { return population->getGeneration(); }
+
+  /**
+   * @brief Get the width and height of the world, excluding the rim
+   * @return Dimensions of the world
+   */
+  const Dimensions &getWorldDimensions() const {
+    return population->getWorldDimensions();
+  }
+
+  /**
+   * @brief Get the cell at a position
+   * @param position position of the cell, the rim is at 0 and the width or
+   * height + 1
+   * @return Cell the cell, shown as in takeSnapshot
+   */
+  const Cell &getCellAtPosition(Point position) const {
+    return population->getCellAtPosition(position);
+  }
+
+  /**
+   * @brief Copies the cells into a frame, for consumers that keeps them
+   * @param frame set to the generation and cells, its vectors are reused
+   */
+  void takeSnapshot(Frame &frame) const { population->takeSnapshot(frame); }
+
+  /**
+   * @brief Get the viewed population
+   * @return Population the population
+   */
+  Population &getPopulation() const { return *population; }
+};
+
+/**
+ * @brief Stream of the generations of a population, pulled one at a time.
+ *
+ * @details Iterating the stream first gives the generation the population
+ * is at, and then calculates one sweep of generations for every step, until
+ * the last generation is reached. Consumers decide when the next generation
+ * is calculated, so they can step, skip generations with skip() or take
+ * batches, without frames being copied. The iterators are input iterators,
+ * there is only one position in the stream, the one of the population.
+ */
+class GenerationStream {
+ private:
+  Population &population;  ///< population calculating the generations
+  int lastGeneration;      ///< generations are calculated until this one
+
+ public:
+  /**
+   * @brief Input iterator over the generations of the stream
+   */
+  class iterator {
+   private:
+    GenerationStream *stream;  ///< the stream, nullptr at the end
+    GenerationView view;       ///< view of the population
+
+   public:
+    using iterator_category = input_iterator_tag;  ///< single pass
+    using value_type = GenerationView;             ///< views are given
+    using difference_type = ptrdiff_t;             ///< generations apart
+    using pointer = const GenerationView *;        ///< pointer to a view
+    using reference = const GenerationView &;      ///< reference to a view
+
+    /**
+     * @brief Constructor
+     * @param stream the stream, nullptr for the end
+     * @param population population of the stream
+     */
+    iterator(GenerationStream *stream, Population &population)
+        : stream(stream), view(population) {}
+
+    /// @brief The view of the current generation
+    reference operator*() const { return view; }
+    /// @brief The view of the current generation
+    pointer operator->() const { return &view; }
+
+    /**
+     * @brief Calculates the next sweep of generations
+     * @return iterator this iterator, at the end after the last generation
+     */
+    iterator &operator++();
+
+    /// @brief Same as the prefix operator, iterators can not be copied back
+    void operator++(int) { ++*this; }
+
+    /// @brief Iterators are equal when both are at the end, or both are not
+    bool operator==(const iterator &other) const {
+      return atEnd() == other.atEnd();
+    }
+    /// @brief Iterators are equal when both are at the end, or both are not
+    bool operator!=(const iterator &other) const { return !(*this == other); }
+
+    /**
+     * @brief If the last generation has been given
+     * @return bool true at the end of the stream
+     */
+    bool atEnd() const;
+  };
+
+  /**
+   * @brief Constructor
+   * @param population the population, initiated, must outlive the stream
+   * @param lastGeneration generations are calculated until this one, which
+   * is not given
+   */
+  GenerationStream(Population &population, int lastGeneration)
+      : population(population), lastGeneration(lastGeneration) {}
+
+  /**
+   * @brief Iterator at the generation the population is at
+   * @test That the generations follows each other until the last one
+   * @return iterator the current generation
+   */
+  iterator begin() { return iterator(this, population); }
+
+  /**
+   * @brief Iterator at the end of the stream
+   * @return iterator the end
+   */
+  iterator end() { return iterator(nullptr, population); }
+
+  /**
+   * @brief Calculates generations without giving them
+   * @details Stops at the last generation of the stream.
+   * @test That the generations are the same as when stepping
+   * @param generations number of generations to skip, whole sweeps are
+   * calculated
+   * @return GenerationView view of the generation after the skipped ones
+   */
+  GenerationView skip(int generations);
+
+  /**
+   * @brief Get the generation the stream ends before
+   * @return int the last generation
+   */
+  int getLastGeneration() const { return lastGeneration; }
+};
+
+#ifdef GAMEOFLIFE_HAS_COROUTINES
+
+/**
+ * @brief Generator of values yielded by a coroutine.
+ *
+ * @details The coroutine runs when the next value is asked for, and is
+ * suspended at every co_yield. The yielded value is referred to, not copied.
+ * @tparam T type of the yielded values
+ */
+template <typename T>
+class Generator {
+ public:
+  /**
+   * @brief Promise of the coroutine, holds the yielded value
+   */
+  struct promise_type {
+    const T *value = nullptr;     ///< the last yielded value
+    exception_ptr failure;        ///< exception thrown by the coroutine
+
+    /// @brief The generator handed to the caller of the coroutine
+    Generator get_return_object() {
+      return Generator(coroutine_handle<promise_type>::from_promise(*this));
+    }
+    /// @brief The coroutine runs when the first value is asked for
+    suspend_always initial_suspend() noexcept { return {}; }
+    /// @brief The coroutine is destroyed by the generator
+    suspend_always final_suspend() noexcept { return {}; }
+    /// @brief Keeps the value until the coroutine is resumed
+    suspend_always yield_value(const T &yielded) noexcept {
+      value = &yielded;
+      return {};
+    }
+    /// @brief Nothing is returned, only yielded
+    void return_void() noexcept {}
+    /// @brief Passes the exception on to the caller of the generator
+    void unhandled_exception() { failure = current_exception(); }
+  };
+
+  /**
+   * @brief Input iterator over the yielded values
+   */
+  class iterator {
+   private:
+    coroutine_handle<promise_type> handle;  ///< the coroutine, null at end
+
+   public:
+    using iterator_category = input_iterator_tag;  ///< single pass
+    using value_type = T;                          ///< yielded values
+    using difference_type = ptrdiff_t;             ///< values apart
+    using pointer = const T *;                     ///< pointer to a value
+    using reference = const T &;                   ///< reference to a value
+
+    /// @brief Constructor, a null handle is the end
+    explicit iterator(coroutine_handle<promise_type> handle) : handle(handle) {}
+
+    /// @brief The last yielded value
+    reference operator*() const { return *handle.promise().value; }
+    /// @brief The last yielded value
+    pointer operator->() const { return handle.promise().value; }
+
+    /// @brief Resumes the coroutine until it yields or returns
+    iterator &operator++() {
+      handle.resume();
+      if (handle.done()) {
+        exception_ptr failure = handle.promise().failure;
+        handle = nullptr;
+        if (failure)
+          rethrow_exception(failure);
+      }
+      return *this;
+    }
+    /// @brief Same as the prefix operator
+    void operator++(int) { ++*this; }
+
+    /// @brief Iterators are equal when they refer to the same coroutine
+    bool operator==(const iterator &other) const {
+      return handle == other.handle;
+    }
+    /// @brief Iterators are equal when they refer to the same coroutine
+    bool operator!=(const iterator &other) const { return !(*this == other); }
+  };
+
+  /// @brief Generators own their coroutine and can only be moved
+  Generator(Generator &&other) noexcept
+      : handle(exchange(other.handle, nullptr)) {}
+  Generator(const Generator &) = delete;
+  Generator &operator=(const Generator &) = delete;
+  /// @brief Destroys the coroutine, wherever it is suspended
+  ~Generator() {
+    if (handle)
+      handle.destroy();
+  }
+
+  /**
+   * @brief Runs the coroutine to its first value
+   * @return iterator at the first value, or the end
+   */
+  iterator begin() {
+    if (!handle)
+      return end();
+    iterator first(handle);
+    return ++first;
+  }
+
+  /**
+   * @brief The end of the values
+   * @return iterator the end
+   */
+  iterator end() { return iterator(nullptr); }
+
+ private:
+  coroutine_handle<promise_type> handle;  ///< the coroutine
+
+  /// @brief Constructor, used by the promise
+  explicit Generator(coroutine_handle<promise_type> handle) : handle(handle) {}
+};
+
+/**
+ * @brief Coroutine yielding a view of every sweep of generations
+ * @details The same as iterating a GenerationStream, for consumers written
+ * as coroutines. A generation is only calculated when the next view is asked
+ * for.
+ * @test That the views are the same as from GenerationStream
+ * @param population the population, initiated, must outlive the generator
+ * @param lastGeneration generations are calculated until this one, which is
+ * not given
+ * @return Generator of GenerationView
+ */
+Generator<GenerationView> generateGenerations(Population &population,
+                                              int lastGeneration);
+
+#endif
+
+#endif //GAMEOFLIFE_GENERATIONSTREAM_H
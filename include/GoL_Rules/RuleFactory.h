@@ -10,6 +10,10 @@
 #ifndef RULEFACTORY_H
 #define RULEFACTORY_H
 
+#include <functional>
+#include <map>
+#include <string>
+#include <vector>
 #include "GoL_Rules/RuleOfExistence.h"
 
 /**
@@ -18,20 +22,33 @@
  * - Conway
  * - VonNeumann
  * - Erik
+ *
+ * Further rules can be registered by name, either directly or by loading
+ * rule plugins from a directory.
  */
 class RuleFactory {
+ public:
+  /// @brief Function creating a rule for the given game board
+  typedef function<RuleOfExistence *(map<Point, Cell> &)> RuleCreator;
+
  private:
   /// @brief private constructor
   RuleFactory() = default;
 
+  /// @brief Rules registered by name, checked before the built in rules
+  static map<string, RuleCreator> registeredRules;
+
+  /// @brief Handles of loaded plugin libraries, kept open while running
+  static vector<void *> pluginHandles;
+
  public:
   /// @brief Get the instance of the singelton class
   static RuleFactory &getInstance();
 
   /**
    * @brief Create an instance of the wanted RuleOfExistence
-   * @details Supported rules Conway, VonNeumann and Eric. If no rule name or
-   * if an invalid name is supplied Conway is used.
+   * @details Supported rules Conway, VonNeumann and Eric, and any registered
+   * rule. If no rule name or if an invalid name is supplied Conway is used.
    * Identification strings
    *  - von_neumann
    *  - eric
@@ -56,6 +73,42 @@ class RuleFactory {
    */
   RuleOfExistence *createAndReturnRule(map<Point, Cell> &cells,
                                        const string &ruleName = "conway");
+
+  /**
+   * @brief Register a rule that can be created by name
+   * @details A registered rule is used instead of a built in rule with the
+   * same name. Registering a name again replaces the earlier registration.
+   *
+   * @test That a registered rule is created by createAndReturnRule
+   *
+   * @param ruleName name used to select the rule
+   * @param creator function creating the rule
+   */
+  void registerRule(const string &ruleName, RuleCreator creator);
+
+  /**
+   * @brief Check if a rule has been registered with the given name
+   * @param ruleName name of the rule
+   * @return bool true if the rule is registered
+   */
+  bool isRegistered(const string &ruleName) {
+    return registeredRules.count(ruleName) > 0;
+  }
+
+  /**
+   * @brief Load all rule plugins in a directory
+   * @details Every shared library in the directory exporting
+   * GOL_RULE_PLUGIN_ENTRY with a matching ABI version is registered under the
+   * name given by the plugin. Other files are ignored. Plugins are not
+   * supported on Windows, where no plugins are loaded.
+   *
+   * @test That the sample plugin is loaded and registered by name
+   * @test That a non existent directory loads no plugins
+   *
+   * @param directory path of the directory to load plugins from
+   * @return int number of loaded plugins
+   */
+  int loadPlugins(const string &directory);
 };
 
 #endif
\ No newline at end of file
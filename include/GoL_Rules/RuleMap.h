@@ -0,0 +1,112 @@
+/**
+ * @file    RuleMap.h
+ * @author      Group 11
+ * @date        October 2026
+ * @version     0.3
+ *
+ * @brief This file contains the RuleMap, used to let different regions of
+ * the world evolve under different rules.
+ *
+ * @details A rule map is loaded from a file given alongside the seed file.
+ * Each line of the file assigns a rule to a rectangle of the world.
+*/
+
+#ifndef GAMEOFLIFE_RULEMAP_H
+#define GAMEOFLIFE_RULEMAP_H
+
+#include <string>
+#include <vector>
+#include "Support/SupportStructures.h"
+
+using namespace std;
+
+/**
+ * @brief Data structure holding a region of the world and the rules used
+ * for it.
+ */
+struct RuleArea {
+  Region region;        ///< the cells the rules are applied to
+  string evenRuleName,  ///< rule used for even generations, empty for default
+      oddRuleName;      ///< rule used for odd generations, empty for default
+};
+
+/**
+ * @brief Assigns rules to rectangular areas of the world.
+ *
+ * @details Areas are stored in the order they were added and later areas
+ * overrides earlier ones where they overlap. Cells that are not covered by
+ * any area uses the default rules of the Population.
+ *
+ * The file format has one area per line
+ *
+ *     <column> <row> <width>x<height> <even rule> [odd rule]
+ *
+ * where column and row is the upper left cell of the area, 1,1 being the
+ * first cell inside the rim. If no odd rule is given the even rule is used
+ * for both. Empty lines and lines starting with # are ignored.
+ */
+class RuleMap {
+ private:
+  vector<RuleArea> areas;
+
+ public:
+  /// @brief default constructor, creates an empty rule map
+  RuleMap() = default;
+
+  /**
+   * @brief Load the rule areas from file.
+   *
+   * @details Areas read from the file are added after the already existing
+   * areas.
+   *
+   * @test That areas are read with the correct region and rule names
+   * @test That comments and empty lines are ignored
+   * @test That an exception is thrown for a missing file
+   * @test That an exception is thrown for a malformed line
+   *
+   * @param ruleMapFileName name of the file to read
+   * @throws ios_base::failure if the file can't be read or a line is malformed
+   */
+  void loadFromFile(const string &ruleMapFileName);
+
+  /**
+   * @brief Add a rule area to the map.
+   *
+   * @param region the cells the rules are applied to
+   * @param evenRuleName rule used for even generations
+   * @param oddRuleName rule used for odd generations, if empty the even rule
+   * is used
+   */
+  void addArea(const Region &region, const string &evenRuleName,
+               string oddRuleName = "");
+
+  /**
+   * @brief Get the added areas, in the order they were added.
+   * @return vector of RuleArea
+   */
+  const vector<RuleArea> &getAreas() const { return areas; }
+
+  /**
+   * @brief Split the world into tiles with a single rule assignment each.
+   *
+   * @details The world is first split into tiles of tileSize x tileSize
+   * cells. Tiles crossing the edge of an area are split further along that
+   * edge, so every returned region is covered by exactly one assignment and
+   * rules can be dispatched per tile instead of per cell. Regions are
+   * returned row by row, left to right. Regions not covered by any area have
+   * empty rule names.
+   *
+   * @test That the returned regions covers the world without overlapping
+   * @test That no region is larger than the tile size
+   * @test That regions inside an area gets the rule names of the area
+   * @test That the last added area wins where areas overlap
+   *
+   * @param world region covering the whole world, rim included
+   * @param tileSize the largest width and height of a tile, 0 or less gives
+   * tiles as large as the areas allows
+   * @return vector of RuleArea covering the world
+   */
+  vector<RuleArea> partition(const Region &world, int tileSize) const;
+};
+
+#endif //GAMEOFLIFE_RULEMAP_H
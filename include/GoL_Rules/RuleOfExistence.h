@@ -20,7 +20,7 @@
 #include <utility>
 #include<vector>
 #include "Cell_Culture/Cell.h"
-#include "Support/Globals.h"
+#include "Support/SupportStructures.h"
 
 using namespace std;
 
@@ -61,6 +61,13 @@ const vector<Directions> CARDINAL{{0, -1}, {1, 0}, {0, 1}, {-1, 0}};
 /// @brief vector defining the Diagonal directions (NE, SE, SW, NW)
 const vector<Directions> DIAGONAL{{1, -1}, {1, 1}, {-1, 1}, {-1, -1}};
 
+/**
+ * @brief Number of entries in a step table, one for every 3x3 neighbourhood.
+ * @details Bit (VERTICAL + 1) * 3 + (HORIZONTAL + 1) of the index is set when
+ * the cell at that direction is alive, bit 4 is the cell itself.
+ */
+const int STEP_TABLE_SIZE = 512;
+
 /**
  * @brief Abstract base class, upon which concrete rules will derive.
  *
@@ -137,6 +144,38 @@ class RuleOfExistence {
    */
   ACTION getAction(int aliveNeighbours, bool isAlive);
 
+  /**
+   * @brief Builds a step table from the population limits and directions
+   *
+   * @details Each entry is 1 if the cell is alive in the next generation.
+   * Only usable by rules where the next state only depends on getAction.
+   *
+   * @param table set to STEP_TABLE_SIZE entries
+   */
+  void buildStepTable(vector<unsigned char> &table);
+
+  /**
+   * @brief Calls the supplied function for every cell inside the region
+   *
+   * @details Walks the cells column by column, which is the order they are
+   * stored in the map, so only one lookup per column is needed. Positions
+   * inside the region that does not exist in the map are skipped.
+   *
+   * @param region the part of the game board to visit
+   * @param function called with the position and the cell
+   */
+  template<typename Function>
+  void forEachCellIn(const Region &region, Function function) {
+    for (int column = region.topLeft.x; column <= region.bottomRight.x;
+         column++) {
+      auto it = cells.lower_bound(Point{column, region.topLeft.y});
+      for (; it != cells.end() && it->first.x == column
+          && it->first.y <= region.bottomRight.y; ++it) {
+        function(it->first, it->second);
+      }
+    }
+  }
+
  public:
   /**
    * @brief Constructor for the abstract class RuleOfExistence
@@ -161,11 +200,66 @@ class RuleOfExistence {
         ruleName(std::move(ruleName)) {}
   virtual ~RuleOfExistence() = default;
 
+  /**
+   * @brief Execute rule for every cell on the game board
+   *
+   * @details Executes the rule for a region covering the whole map of cells,
+   * as one full generation between beginGeneration and endGeneration.
+   *
+   * @test That the whole game board is updated
+   */
+  void executeRule();
+
+  /**
+   * @brief Called once every generation before the regions are executed
+   * @details Rules that combines results from several regions, such as
+   * finding the oldest cell, resets their state here.
+   */
+  virtual void beginGeneration() {}
+
+  /**
+   * @brief Called once every generation after all regions are executed
+   * @details Rules that combines results from several regions applies the
+   * combined result here.
+   */
+  virtual void endGeneration() {}
+
+  /**
+   * @brief Describes the rule as a table over 3x3 neighbourhoods
+   *
+   * @details Rules that only decides if cells lives or dies, and colors them
+   * as Conway does, can be described by a table with the next state of the
+   * cell for each neighbourhood, see STEP_TABLE_SIZE. The table lets the
+   * population run the rule on a dense grid instead.
+   *
+   * @test That the table gives the same result as executeRule
+   *
+   * @param table set to STEP_TABLE_SIZE entries, if the rule has a table
+   * @return bool false if the rule can not be described by a table
+   */
+  virtual bool getStepTable(vector<unsigned char> &) { return false; }
+
+  /**
+   * @brief If dead cells without alive neighbours stays dead
+   *
+   * @details The rule gives no new action to the cells of a region where no
+   * cell, and no cell around it, is alive. Such regions may be skipped.
+   *
+   * @return bool true if a dead cell without alive neighbours stays dead
+   */
+  virtual bool emptyStaysEmpty() { return getAction(0, false) != GIVE_CELL_LIFE; }
+
   /**
    * @brief Execute rule, in order specific to the concrete rule, by utilizing
-   * template method DP
+   * template method DP, for the cells inside the region
+   *
+   * @details Only the next generation values of the cells inside the region
+   * are changed, but neighbours outside of it are read. Several regions may
+   * therefore use different rules during the same generation.
+   *
+   * @param region the part of the game board to execute the rule for
    */
-  virtual void executeRule() = 0;
+  virtual void executeRule(const Region &region) = 0;
 
   /**
    * @brief Get function for the rule name
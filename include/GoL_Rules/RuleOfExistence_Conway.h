@@ -38,6 +38,8 @@ class RuleOfExistence_Conway : public RuleOfExistence {
 /// @brief default destructor
   ~RuleOfExistence_Conway() override = default;
 
+  using RuleOfExistence::executeRule;
+
 /**
  * @brief Calculates and updates the cell population (game board) for the
  * next generation
@@ -53,8 +55,21 @@ class RuleOfExistence_Conway : public RuleOfExistence {
  * dead cell is given life
  * @test That the color, and other cell properties, changes correctly when a
  * alive cell is killed
+ *
+ * @param region the part of the game board to execute the rule for
+ */
+  void executeRule(const Region &region) override;
+
+/**
+ * @brief Describes Conway's rule as a table over 3x3 neighbourhoods
+ * @test That the table gives the same result as executeRule
+ * @param table set to STEP_TABLE_SIZE entries
+ * @return bool always true
  */
-  void executeRule() override;
+  bool getStepTable(vector<unsigned char> &table) override {
+    buildStepTable(table);
+    return true;
+  }
 };
 
 #endif //GAMEOFLIFE_RULEOFEXISTENCE_CONWAY_H
@@ -11,8 +11,37 @@
 #define GAMEOFLIFE_RULEOFEXISTENCE_ERIK_H
 
 
+#include <mutex>
 #include "RuleOfExistence.h"
 
+/**
+ * @brief Data structure holding the best prime elder candidate found so far.
+ *
+ * @details Candidates found in different tiles, or by different threads, are
+ * combined with merge(). The result does not depend on the order of the
+ * merges: the oldest cell wins and if several cells have the same age the
+ * one first in map order, lowest column and then lowest row, wins.
+ */
+struct ElderCandidate {
+  Point position;  ///< position of the candidate cell
+  int age;         ///< age of the candidate cell
+  bool found;      ///< false until a candidate has been found
+
+  /**
+   * @brief Keep the better of this and the other candidate
+   * @test That the oldest candidate is kept
+   * @test That the first position in map order is kept for equal ages
+   * @param other candidate to compare with
+   */
+  void merge(const ElderCandidate &other) {
+    if (!other.found)
+      return;
+    if (!found || other.age > age
+        || (other.age == age && other.position < position))
+      *this = other;
+  }
+};
+
 /**
  * @brief Erik's RuleOfExistence, based on Conway's rule while also
  * differentiate the appearance of cells based on their age.
@@ -29,6 +58,11 @@
  * become a **prime elder**, and have its color changed once again. A generation
  * may only have one such elder.
  *
+ * The prime elder is found as a reduction over the generation. Every call to
+ * executeRule(region) finds the best candidate in its region and merges it
+ * into the candidate of the generation, the winner is marked when the
+ * generation ends. Regions may be executed in any order, or concurrently.
+ *
  * @issue The class name "conway" should be declared as a class constant that
  * is accessable from the outside
 */
@@ -41,45 +75,69 @@ private:
    * @issue Since it is not changed should it be defined as a constant?
    */
     char usedCellValue;
-    Cell* primeElder; ///< @brief Reference to an current elder cell
+    Point primeElder; ///< @brief Position of the current elder cell
+    bool hasPrimeElder; ///< @brief If there is a current elder cell
+    ElderCandidate generationElder; ///< @brief Best candidate this generation
+    mutex elderMutex; ///< @brief Guards generationElder between threads
 
     /**
-     * @brief Applies the Erik specific rules
+     * @brief Applies the Erik specific rules to dense arrays of cells
      *
      * @details Checks if a living cell has reached the age of an old or Erik
      * cells
      * and sets their next gen colo and next gen value.
-     * Checks if the cell is the oldest cell, if so it sets the cell as the
-     * elder
-     * If a cell is killed the cell value is reset to # and the cell is
-     * removed as the elder if it is killed.
+     * If a cell is killed the cell value is reset to #.
+     * The arrays holds the cells of a region after the Conway transition, the
+     * loop uses selects instead of branches so the compiler can vectorize it.
      *
      * @test That an cell is marked as old when older than 5 generations,
      * STATE_COLORS.OLD
      * @test That the OLD color is reset when a Living cell, OLD is killed
      * @test That the Elder color is reset when a Elder cell is killed
      * @test That an cell cell that reached the Erik state is marked with an 'E'
-     * @test That the oldest cell older than 10 get the status Elder
-     * @test That the elder data is reset when an elder cell dies
-     * @test That only one elder can exists
-
-     * @test That the correct Elder is set when an current Elder cell dies
      *
      * @issue Im missing how >4 relates to the requirement >5
      * @issue 4 is a magic number. Should be replaced with a class constant
      * @issue Im missing how >9 relates to the requirement >10
      * @issue 9 is a magic number. Should be replaced with a class constant
      *
-     * @param cell The current cell to update
-     * @param action The cell action
+     * @param ages The current age of each cell
+     * @param killed 1 for each cell that is killed, otherwise 0
+     * @param currentValues The current value of each cell
+     * @param colors The next color of each cell, updated
+     * @param values The next value of each cell, updated
+     * @param count Number of cells in the arrays
+     */
+    void erikfyCells(const int* ages, const unsigned char* killed,
+                     const char* currentValues, int* colors, char* values,
+                     size_t count) const;
+
+    /**
+     * @brief Merges the cells old enough to be the elder into the candidate
+     *
+     * @details The elder is chosen when the generation ends.
+     *
+     * @test That the oldest cell older than 10 get the status Elder
+     * @test That the elder data is reset when an elder cell dies
+     * @test That only one elder can exists
+     * @test That the correct Elder is set when an current Elder cell dies
+     *
+     * @param positions The position of each cell
+     * @param ages The current age of each cell
+     * @param killed 1 for each cell that is killed, otherwise 0
+     * @param count Number of cells in the arrays
+     * @param candidate The best elder candidate of the current region
      */
-    void erikfyCell(Cell& cell, ACTION action);
+    void findElderCandidate(const Point* positions, const int* ages,
+                            const unsigned char* killed, size_t count,
+                            ElderCandidate& candidate) const;
 
     /**
-     * @brief Sets the private variable elder to the provided cell
-     * @param newElder new elder
+     * @brief Sets the private variable elder to the provided position and
+     * marks the cell with the elder color
+     * @param newElder position of the new elder
      */
-    void setPrimeElder(Cell* newElder);
+    void setPrimeElder(const Point& newElder);
 
 public:
   /** @brief default constructor
@@ -88,17 +146,43 @@ public:
    */
     explicit RuleOfExistence_Erik(map<Point, Cell>& cells)
             : RuleOfExistence({2,3,3}, cells, ALL_DIRECTIONS, "erik"), usedCellValue('E') {
-        primeElder = nullptr;
+        primeElder = Point{0, 0};
+        hasPrimeElder = false;
+        generationElder = ElderCandidate{Point{0, 0}, 0, false};
     }
 
     /// @brief Deconstructor
     ~RuleOfExistence_Erik() override = default;
 
+    using RuleOfExistence::executeRule;
+
+    /**
+     * @brief Resets the elder candidate before the regions are executed
+     */
+    void beginGeneration() override;
+
+    /**
+     * @brief Marks the best candidate of the generation as prime elder
+     * @test That only the oldest cell is marked, regardless of region order
+     */
+    void endGeneration() override;
+
+    /**
+     * @brief Get the position of the current prime elder
+     * @param position set to the elder position if there is one
+     * @return bool true if there is a prime elder
+     */
+    bool getPrimeElder(Point& position) const {
+        position = primeElder;
+        return hasPrimeElder;
+    }
+
   /**
    * @brief Executes the game rules.
    * @details Cells that are Killed gets the color STATE_COLORS.DEAD
    * Cells that are given life gets the color STATE_COLORS.LIVING
-   * Specific Eriks rules are supplied in by function erikfyCell
+   * Specific Eriks rules are supplied in by function erikfyCells, as a
+   * separate pass over the ages of the region after the Conway transition
    *
    * @test that a Cell that is given life gets the color STATE_COLORS.LIVING
    * but the same value
@@ -107,8 +191,9 @@ public:
    * @test that a Alive cell that stays Alive does not change color or value
    * @test that a Dead cell that stays Dead does not change color or value
    *
+   * @param region the part of the game board to execute the rule for
    */
-    void executeRule() override;
+    void executeRule(const Region &region) override;
 };
 
 #endif //GAMEOFLIFE_RULEOFEXISTENCE_ERIK_H
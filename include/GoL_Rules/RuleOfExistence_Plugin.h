@@ -0,0 +1,79 @@
+/**
+ * @file    RuleOfExistence_Plugin.h
+ * @author      Group 11
+ * @date        October 2026
+ * @version     0.3
+ *
+ * @brief This file contains the class executing rules loaded from plugins
+*/
+
+#ifndef GAMEOFLIFE_RULEOFEXISTENCE_PLUGIN_H
+#define GAMEOFLIFE_RULEOFEXISTENCE_PLUGIN_H
+
+#include "RuleOfExistence.h"
+#include "RulePlugin.h"
+
+/**
+ * @brief RuleOfExistence that lets a plugin step function decide which cells
+ * are alive in the next generation.
+ *
+ * @details The cells of a region, and a one cell halo around it, are packed
+ * into a dense grid that is handed to the plugin. The result is translated
+ * back into actions. Cells that are given life gets the color
+ * STATE_COLORS.LIVING and killed cells STATE_COLORS.DEAD, as for Conway.
+ * PopulationLimits and directions are not used by this rule.
+ */
+class RuleOfExistence_Plugin : public RuleOfExistence {
+ private:
+  const GoLRulePlugin &plugin;  ///< @brief the loaded plugin
+
+ public:
+  /**
+   * @brief constructor
+   * @test Test that the rule name of the plugin is used
+   * @param cells game board
+   * @param plugin description of the loaded plugin, must outlive the rule
+   */
+  RuleOfExistence_Plugin(map<Point, Cell> &cells, const GoLRulePlugin &plugin)
+      : RuleOfExistence({2, 3, 3}, cells, ALL_DIRECTIONS, plugin.name),
+        plugin(plugin) {}
+  /// @brief default destructor
+  ~RuleOfExistence_Plugin() override = default;
+
+  using RuleOfExistence::executeRule;
+
+  /**
+   * @brief Calculates the next generation for the region with the plugin
+   *
+   * @details Rim cells are ignored. Uses one call to the plugin step function
+   * for the whole region.
+   *
+   * @test That the actions set for the cells follows the plugin result
+   *
+   * @param region the part of the game board to execute the rule for
+   */
+  void executeRule(const Region &region) override;
+
+  /**
+   * @brief Describes the plugin rule as a table over 3x3 neighbourhoods
+   *
+   * @details The step function only sees a one cell halo, so calling it
+   * once for every neighbourhood of a single cell describes it completely.
+   *
+   * @test That the table gives the same result as executeRule
+   *
+   * @param table set to STEP_TABLE_SIZE entries
+   * @return bool always true
+   */
+  bool getStepTable(vector<unsigned char> &table) override;
+
+  /**
+   * @brief If dead cells without alive neighbours stays dead
+   * @details Asks the step function about a dead cell without alive
+   * neighbours.
+   * @return bool true if the cell stays dead
+   */
+  bool emptyStaysEmpty() override;
+};
+
+#endif //GAMEOFLIFE_RULEOFEXISTENCE_PLUGIN_H
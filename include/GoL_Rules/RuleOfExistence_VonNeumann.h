@@ -38,6 +38,8 @@ public:
     /// @brief Default destructor
             ~RuleOfExistence_VonNeumann() override = default;
 
+    using RuleOfExistence::executeRule;
+
 /**
  * @brief calculates the next generation values for the VonNewmann rules
  *
@@ -55,8 +57,21 @@ public:
  * alive cell is killed
  * @test That a alive cell dies when 1 Cardinal and 1 Diagonal neighbor is
  * alive, Neumann should only counts Cardinal distances
+ *
+ * @param region the part of the game board to execute the rule for
+ */
+    void executeRule(const Region &region) override;
+
+/**
+ * @brief Describes Von Neumann's rule as a table over 3x3 neighbourhoods
+ * @test That the table gives the same result as executeRule
+ * @param table set to STEP_TABLE_SIZE entries
+ * @return bool always true
  */
-    void executeRule() override;
+    bool getStepTable(vector<unsigned char> &table) override {
+      buildStepTable(table);
+      return true;
+    }
 };
 
 #endif //GAMEOFLIFE_RULEOFEXISTENCE_VONNEUMANN_H
@@ -0,0 +1,75 @@
+/**
+ * @file    RulePlugin.h
+ * @author      Group 11
+ * @date        October 2026
+ * @version     0.3
+ *
+ * @brief This file contains the C interface for rule kernel plugins.
+ *
+ * @details A rule plugin is a shared library exporting the function named by
+ * GOL_RULE_PLUGIN_ENTRY. The function returns a description of the rule with
+ * a step function that calculates the next generation for one tile of the
+ * world at a time, packed as a dense grid of cells. Plugins are loaded from a directory by RuleFactory::loadPlugins and
+ * can then be used by name like the built in rules.
+ *
+ * The header is plain C so plugins can be written in C or any language with a
+ * C compatible ABI.
+*/
+
+#ifndef GAMEOFLIFE_RULEPLUGIN_H
+#define GAMEOFLIFE_RULEPLUGIN_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** @brief Version of the plugin interface, plugins of other versions are not
+ * loaded. */
+#define GOL_RULE_PLUGIN_ABI_VERSION 1
+
+/** @brief Name of the function every plugin must export. */
+#define GOL_RULE_PLUGIN_ENTRY "gol_rule_plugin"
+
+/**
+ * @brief Calculates the next generation for one tile of the world.
+ *
+ * @details The step is called once per tile, not once over the whole world.
+ * Cells are stored one byte per cell, row by row, where 1 is an alive cell
+ * and 0 a dead cell. The input grid is the tile with a one cell halo on
+ * every side, making it (width + 2) x (height + 2) cells, the output grid is
+ * width x height cells. Rows are inStride and outStride bytes apart.
+ *
+ * The halo holds the real cells around the tile, which are alive or dead as
+ * in the neighbouring tiles. Only the rim of the world is always dead, so the
+ * halo of a tile at the edge of the world, and the rim cells a tile may
+ * include, are 0. The output for rim cells is ignored.
+ *
+ * The function may be called concurrently for different tiles and must not
+ * keep any state between calls.
+ *
+ * @param in input grid, including the halo
+ * @param inStride bytes between two rows of the input grid
+ * @param out output grid, excluding the halo
+ * @param outStride bytes between two rows of the output grid
+ * @param width number of columns to calculate
+ * @param height number of rows to calculate
+ */
+typedef void (*GoLRuleStep)(const unsigned char *in, int inStride,
+                            unsigned char *out, int outStride,
+                            int width, int height);
+
+/** @brief Description of a rule, returned by the plugin entry function. */
+typedef struct GoLRulePlugin {
+  unsigned int abiVersion; /**< must be GOL_RULE_PLUGIN_ABI_VERSION */
+  const char *name;        /**< rule name used to select the rule */
+  GoLRuleStep step;        /**< calculates the next generation */
+} GoLRulePlugin;
+
+/** @brief Signature of the function named by GOL_RULE_PLUGIN_ENTRY. */
+typedef const GoLRulePlugin *(*GoLRulePluginEntry)(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif //GAMEOFLIFE_RULEPLUGIN_H
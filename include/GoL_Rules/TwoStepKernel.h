@@ -0,0 +1,80 @@
+/**
+ * @file    TwoStepKernel.h
+ * @author      Group 11
+ * @date        October 2026
+ * @version     0.3
+ *
+ * @brief This file contains the kernel advancing a dense grid of cells two
+ * generations in one sweep.
+*/
+
+#ifndef GAMEOFLIFE_TWOSTEPKERNEL_H
+#define GAMEOFLIFE_TWOSTEPKERNEL_H
+
+#include <vector>
+#include "RuleOfExistence.h"
+
+using namespace std;
+
+/**
+ * @brief Composes the step tables of two rules into one kernel, where each
+ * sweep over the grid advances two generations.
+ *
+ * @details The grid is stored one byte per cell, row by row, where 1 is an
+ * alive cell and 0 a dead cell. The outermost rows and columns are the rim of
+ * the world and are never alive. The state of a cell two generations ahead
+ * depends on the 5x5 cells around it; the kernel calculates the rows of the
+ * first generation one row ahead of the rows of the second generation, so the
+ * grid is only swept once.
+ */
+class TwoStepKernel {
+ private:
+  vector<unsigned char> firstTable;   ///< step table of the first generation
+  vector<unsigned char> secondTable;  ///< step table of the second generation
+
+  /**
+   * @brief Calculates one row of the next generation with a step table
+   * @param table step table to use, see STEP_TABLE_SIZE
+   * @param from grid of the current generation
+   * @param to grid of the next generation
+   * @param row the row to calculate, not a rim row
+   * @param width number of columns of the grids, rim included
+   */
+  static void stepRow(const vector<unsigned char> &table,
+                      const vector<unsigned char> &from,
+                      vector<unsigned char> &to, int row, int width);
+
+ public:
+  /**
+   * @brief Default constructor, the kernel is not usable until assigned
+   */
+  TwoStepKernel() = default;
+
+  /**
+   * @brief Constructor
+   * @param firstTable step table of the rule for the first generation
+   * @param secondTable step table of the rule for the second generation
+   */
+  TwoStepKernel(vector<unsigned char> firstTable,
+                vector<unsigned char> secondTable)
+      : firstTable(std::move(firstTable)),
+        secondTable(std::move(secondTable)) {}
+
+  /**
+   * @brief Advances the grid two generations in one sweep
+   *
+   * @test That the result is the same as executing the rules twice
+   * @test That rim cells are never given life
+   *
+   * @param current grid of the current generation
+   * @param middle set to the grid of the next generation
+   * @param next set to the grid of the generation after that
+   * @param width number of columns of the grids, rim included
+   * @param height number of rows of the grids, rim included
+   */
+  void advance(const vector<unsigned char> &current,
+               vector<unsigned char> &middle, vector<unsigned char> &next,
+               int width, int height) const;
+};
+
+#endif //GAMEOFLIFE_TWOSTEPKERNEL_H
@@ -0,0 +1,159 @@
+/**
+ * @file    ImageExporter.h
+ * @author      Group 11
+ * @date        October 2026
+ * @version     0.3
+ *
+ * @brief This file contains the class writing generations as image files.
+*/
+
+#ifndef GAMEOFLIFE_IMAGEEXPORTER_H
+#define GAMEOFLIFE_IMAGEEXPORTER_H
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include "GenerationStream.h"
+
+using namespace std;
+
+/// @brief Number of generations waiting to be written before more are dropped.
+const int EXPORT_QUEUE_SIZE = 8;
+
+/// @brief Number of threads writing the images.
+const int EXPORT_THREADS = 2;
+
+/// @brief Red, green and blue of each terminal color, as xterm shows them.
+const unsigned char COLOR_RGB[8][3] = {
+    {0, 0, 0},     {205, 0, 0},   {0, 205, 0},   {205, 205, 0},
+    {0, 0, 238},   {205, 0, 205}, {0, 205, 205}, {229, 229, 229}};
+
+/**
+ * @brief Index of a color in COLOR_RGB
+ * @param color terminal color of a cell
+ * @return unsigned char the index, 0 to 7
+ */
+inline unsigned char paletteIndex(COLOR color) {
+  return static_cast<unsigned char>(static_cast<int>(color) & 7);
+}
+
+/**
+ * @brief File formats of the images.
+ */
+enum class ImageFormat {
+  PPM,  ///< binary portable pixmap, three bytes per pixel
+  PNG   ///< palette PNG, compressed without any library
+};
+
+/**
+ * @brief Data structure holding what the exporter did.
+ */
+struct ExportStats {
+  unsigned long written;  ///< images written
+  unsigned long dropped;  ///< generations not written, the queue was full
+  double encodeSeconds;   ///< time spent by the threads encoding and writing
+};
+
+/**
+ * @brief Writes every Nth generation as an image file, on threads of its own.
+ *
+ * @details Each cell of the world is one pixel, rim excluded, with the
+ * colour of the cell from STATE_COLORS. The thread calculating the
+ * generations only copies the cells into a free slot of a bounded queue, the
+ * images are encoded and written by the threads of the exporter. When every
+ * slot is waiting to be written the generation is dropped, and counted,
+ * instead of slowing down the simulation. The files are named
+ * generation_NNNNNN.ppm or .png after the generation of the frame.
+ */
+class ImageExporter {
+ private:
+  string directory;             ///< where the images are written
+  int every;                    ///< generations between two images
+  ImageFormat format;           ///< format of the images
+  int nextGeneration = 0;       ///< first generation of the next image
+  vector<Frame> slots;          ///< the queued frames, reused
+  vector<int> freeSlots;        ///< slots that can be written to
+  deque<int> queuedSlots;       ///< slots waiting to be written, oldest first
+  vector<thread> workers;       ///< threads writing the images
+  mutex queueMutex;             ///< guards the queue, stats and failure
+  condition_variable queued;    ///< signalled when a slot is queued
+  bool stopping = false;        ///< set when the queue is drained
+  ExportStats stats{0, 0, 0.0};  ///< what has been written and dropped
+  exception_ptr failure;        ///< first failure of a worker
+
+  /**
+   * @brief Writes queued frames until the exporter is finished
+   */
+  void workerLoop();
+
+  /**
+   * @brief Encodes a frame and writes it to its file
+   * @param frame the frame to write
+   * @param bytes reused for the encoded image
+   */
+  void writeImage(const Frame &frame, string &bytes);
+
+ public:
+  /**
+   * @brief Constructor, starts the threads
+   * @details Prints a message and throws ios_base::failure if the directory
+   * can not be opened.
+   * @test That the first generation offered is written
+   * @param directory existing directory for the images
+   * @param every generations between two images, at least 1
+   * @param format file format of the images
+   * @param threadCount number of threads writing the images
+   * @param queueSize number of generations waiting to be written
+   */
+  ImageExporter(const string &directory, int every, ImageFormat format,
+                int threadCount = EXPORT_THREADS,
+                int queueSize = EXPORT_QUEUE_SIZE);
+
+  /**
+   * @brief Destructor, writes the queued images and stops the threads
+   */
+  ~ImageExporter();
+
+  /**
+   * @brief Queues the generation if it is due for an image
+   * @details Called by the thread calculating the generations. The cells
+   * are copied into a free slot, nothing is encoded or written by the
+   * caller. The generation is dropped if no slot is free.
+   * @test That generations between two images are not written
+   * @param generation the generation the population is at
+   */
+  void offer(const GenerationView &generation);
+
+  /**
+   * @brief Waits until every queued image is written, and stops the threads
+   * @details Prints a message and throws ios_base::failure if an image
+   * could not be written.
+   * @return ExportStats what was written and dropped
+   */
+  const ExportStats &finish();
+
+  /**
+   * @brief Encodes a frame as a binary PPM
+   * @test That the header and pixels follows the colors of the cells
+   * @param frame the frame to encode
+   * @param bytes set to the image
+   */
+  static void encodePpm(const Frame &frame, string &bytes);
+
+  /**
+   * @brief Encodes a frame as a PNG with a palette of the terminal colors
+   * @details Rows of the same color are compressed as runs with fixed
+   * Huffman codes, so no compression library is needed.
+   * @test That the chunks, size and checksums are valid
+   * @param frame the frame to encode
+   * @param bytes set to the image
+   */
+  static void encodePng(const Frame &frame, string &bytes);
+};
+
+#endif  // GAMEOFLIFE_IMAGEEXPORTER_H
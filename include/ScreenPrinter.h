@@ -20,6 +20,29 @@
 
 #include "../terminal/terminal.h"
 #include "Cell_Culture/Population.h"
+#include "Support/Pacer.h"
+#include "DownsampledRenderer.h"
+#include <chrono>
+
+// stats printed by the printer, declared by the parts of the program making them
+struct SlabStats;
+struct EnsembleResult;
+struct ExportStats;
+struct StreamStats;
+
+/// @brief Writes taking longer than this means the terminal is not keeping up.
+const double SLOW_WRITE_SECONDS = 0.002;
+
+/**
+ * @brief Data structure holding what it has cost to print the frames.
+ */
+struct RenderStats {
+  unsigned long frames = 0;       ///< frames printed
+  unsigned long long bytes = 0;   ///< bytes written for the frames
+  unsigned long writeCalls = 0;   ///< write calls made for the frames
+  double renderSeconds = 0.0;     ///< time spent composing and writing
+  double writeSeconds = 0.0;      ///< time spent writing
+};
 
 /**
  * @brief ScreenPrinter presents the world to the user.
@@ -33,10 +56,46 @@
 class ScreenPrinter {
  private:
   Terminal terminal;
+  Frame shownFrame;         ///< the frame on the screen
+  bool frameShown = false;  ///< if shownFrame is on the screen
+  TerminalBuffer output;    ///< the frame being composed
+  RenderStats renderStats;  ///< cost of the printed frames
+  DownsampledRenderer* renderer = nullptr;  ///< renders the viewport,
+                                            ///< nullptr to print cells
+  vector<uint32_t> shownGlyphs;  ///< the characters of the viewport on the
+                                 ///< screen
+  bool synchronizedOutput = false;  ///< if frames are shown on the alternate
+                                    ///< screen with synchronized updates
+  chrono::steady_clock::time_point terminalBusyUntil;  ///< when the terminal
+                                                       ///< has caught up
+
+  /**
+   * @brief Composes the cells of a frame that differs from the screen
+   * @param frame holding the cells to print.
+   */
+  void composeCells(const Frame& frame);
+
+  /**
+   * @brief Composes the characters of the viewport that differs from the
+   * screen
+   * @param frame holding the cells to render.
+   */
+  void composeDownsampled(const Frame& frame);
+
+  /**
+   * @brief Writes the composed frame and empties the buffer
+   * @details Uses a single write call to the standard output, unless cout
+   * has been redirected, then the frame is written to cout.
+   * @return int number of write calls
+   */
+  int writeOutput();
 
   // @brief Private constructor.
   ScreenPrinter() = default;
 
+  /// @brief Destructor, leaves the alternate screen and deletes the renderer
+  ~ScreenPrinter();
+
  public:
   /**
    * @brief Returns current singleton object instance.
@@ -61,7 +120,7 @@ class ScreenPrinter {
    * @test Test that when the function has been called, something has been
    * entered into the outstream.
    * @test That After a printout, the size of the outstream
-   * should be the same as WORLD_DIMENSIONS.HEIGHT * WORLD_DIMENSIONS.WIDTH.
+   * should be the same as the height times the width of the world.
    *
    * @issue current impementation is unclear. variable WindowHeight is set to
    * world_dimensions.height + 1. The for loop counter starts at 0 and runs
@@ -71,6 +130,67 @@ class ScreenPrinter {
    */
   void printBoard(Population& population);
 
+  /**
+   * @brief print a frame to screen.
+   * @details Prints the cells of a snapshot of the population, so the
+   * population may calculate new generations while it is printed. Rim cells
+   * are not printed. A copy of the printed frame is kept, and only cells
+   * whose value or color differs from it are printed the next time. The
+   * cursor is only moved at the start of each run of changed cells in a row,
+   * and the color only set where it differs from the previous printed cell.
+   * Every cell is printed after clearScreen, or when the size changes.
+   * The frame is composed in a buffer, with escape sequences copied from
+   * tables, and written with a single write call. With downsampling, the
+   * viewport is rendered as dots instead, and only the characters that
+   * differ from the screen are printed.
+   * @param frame holding the cells to print.
+   * @test That the same is printed as for the population of the frame.
+   * @test That only the changed cells are printed for the next frame.
+   */
+  void printBoard(const Frame& frame);
+
+  /**
+   * @brief Set how the frames are shown
+   * @details HALF_BLOCKS and BRAILLE renders the viewport with a
+   * DownsampledRenderer filling the terminal, except its last row. CELLS
+   * prints one character per cell, as by default. The next frame is printed
+   * in full.
+   * @param mode CELLS, HALF_BLOCKS or BRAILLE
+   * @param viewport the shown part of the world, and the cells per dot
+   */
+  void setDownsampling(DownsampleMode mode, const Viewport& viewport);
+
+  /**
+   * @brief Set if frames are shown on the alternate screen with synchronized
+   * updates
+   * @details Turning it on switches the terminal to the alternate screen
+   * buffer, and every frame is then wrapped in synchronized update escapes
+   * (DEC mode 2026), so the terminal shows it at once instead of while it is
+   * drawn. The time each frame takes to write is measured, and a write
+   * slower than SLOW_WRITE_SECONDS makes isTerminalBehind() true for as long
+   * again. Turning it off switches back to the screen from before. The next
+   * frame is printed in full.
+   * @param on true to use the alternate screen and synchronized updates
+   * @test That a printed frame is wrapped in the synchronized update escapes.
+   */
+  void setSynchronizedOutput(bool on);
+
+  /**
+   * @brief If the terminal has not caught up with the last frame
+   * @details Only measured with synchronized output, frames printed before
+   * the terminal has caught up would be queued in the terminal. The caller
+   * should skip them and print the newest frame when it has caught up.
+   * @return bool true if the next frame should be skipped
+   */
+  bool isTerminalBehind() const;
+
+  /**
+   * @brief Get the size of the terminal
+   * @return Dimensions columns and rows of the terminal, 80x24 if the
+   * standard output is not a terminal
+   */
+  static Dimensions getTerminalSize();
+
   /**
    * @brief print a predefined message to user.
    * @details If the user enters the Help Arugment when running, the
@@ -89,10 +209,100 @@ class ScreenPrinter {
    */
   void printMessage(const string& message);
 
+  /**
+   * @brief print what each thread did with work stealing.
+   * @details Prints one line per thread with the number of tiles it ran, how
+   * many of them it stole and the time it waited for the other threads.
+   * @param stats holding one entry for each thread.
+   * @test That one line is printed for each thread.
+   */
+  void printWorkerStats(const vector<WorkerStats>& stats);
+
+  /**
+   * @brief print the estimated cell bandwidth of each NUMA node.
+   * @details Prints one line per node with its threads, the estimated bytes
+   * of cells they went through and the estimated bytes per second while
+   * busy, see NodeStats.
+   * @param stats holding one entry for each node.
+   * @test That one line is printed for each node.
+   */
+  void printNodeStats(const vector<NodeStats>& stats);
+
+  /**
+   * @brief print what each slab worker process did.
+   * @details Prints one line per slab with its rows, the time spent
+   * computing and waiting for the neighbouring slabs, and its alive cells,
+   * followed by the total.
+   * @param stats holding one entry for each slab.
+   * @test That one line is printed for each slab and one for the total.
+   */
+  void printSlabStats(const vector<SlabStats>& stats);
+
+  /**
+   * @brief print the outcome of every seed of an ensemble.
+   * @details Prints a header line followed by one line per seed, as comma
+   * separated values: seed, stabilisation generation, final population and
+   * period.
+   * @param results holding one entry for each seed.
+   * @test That one line is printed for each seed and one for the header.
+   */
+  void printEnsembleResults(const vector<EnsembleResult>& results);
+
+  /**
+   * @brief print the outcome of a simulation without presentation.
+   * @details Prints the generations and the time, generations per second,
+   * cells calculated per second, and the checksum and alive cells of the
+   * last generation, one per line.
+   * @param stats holding the outcome of the simulation.
+   * @test That the checksum is printed.
+   */
+  void printHeadlessStats(const HeadlessStats& stats);
+
+  /**
+   * @brief print the rates a simulation achieved.
+   * @details Prints one line with the frames and generations per second.
+   * @param stats holding the achieved rates.
+   * @test That one line is printed.
+   */
+  void printPacingStats(const PacingStats& stats);
+
+  /**
+   * @brief print what was exported as images.
+   * @details Prints one line with the images written, the generations
+   * dropped because the queue was full, and the time per image.
+   * @param stats holding what the exporter did.
+   * @test That one line is printed.
+   */
+  void printExportStats(const ExportStats& stats);
+
+  /**
+   * @brief print what was streamed.
+   * @details Prints one line with the frames, bytes and write calls, if
+   * the pages were given to a pipe, and if the reader closed the stream.
+   * @param stats holding what was streamed.
+   * @test That one line is printed.
+   */
+  void printStreamStats(const StreamStats& stats);
+
+  /**
+   * @brief Get what it has cost to print the frames
+   * @return RenderStats of every frame printed
+   */
+  const RenderStats& getRenderStats() { return renderStats; }
+
+  /**
+   * @brief print what it has cost to print the frames.
+   * @details Prints one line with the number of frames, and the time, bytes
+   * and write calls per frame, and the time spent writing.
+   * @param stats holding the cost of the frames.
+   * @test That one line is printed.
+   */
+  void printRenderStats(const RenderStats& stats);
+
   /**
    * @brief clear the Terminal
    * @details Sends the clear command to the current Terminal object to clear
-   * the screen from any present data.
+   * the screen from any present data. The next frame is printed in full.
    * @test Testing this class will interfere with the code printout for any
    * other test cases. As such i will not write any test case.
    */
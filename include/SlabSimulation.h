@@ -0,0 +1,153 @@
+/**
+ * @file    SlabSimulation.h
+ * @author      Group 11
+ * @date        October 2026
+ * @version     0.3
+ *
+ * @brief This file contains a simulation split into horizontal slabs, each
+ * calculated by its own process.
+*/
+
+#ifndef GAMEOFLIFE_SLABSIMULATION_H
+#define GAMEOFLIFE_SLABSIMULATION_H
+
+#include <string>
+#include <vector>
+#include "Cell_Culture/Population.h"
+#include "Support/HaloRing.h"
+
+using namespace std;
+
+/// @brief Rows each halo ring holds, lets a slab run one generation ahead.
+const int HALO_RING_SLOTS = 2;
+
+/**
+ * @brief Data structure holding what the process of a slab did.
+ */
+struct SlabStats {
+  int firstRow;            ///< first row of the slab, rim included
+  int lastRow;             ///< last row of the slab, rim included
+  double computeSeconds;   ///< time spent calculating the slab
+  double haloWaitSeconds;  ///< time spent waiting for the neighbours
+  unsigned long aliveCells;  ///< alive cells of the slab when done
+};
+
+/**
+ * @brief Calculates the generations of a world in worker processes, one
+ * horizontal slab of rows each.
+ *
+ * @details The coordinating process forks one worker per slab, and holds no
+ * cells of the world itself. Each worker builds a Population of its own
+ * rows and the row above and below them, see Population::setRows, read from
+ * the file or drawn from the same random streams as the whole world. Every
+ * generation, each worker updates the cells of its slab, sends its first and
+ * last row to the slabs above and below through HaloRings in shared memory,
+ * and receives their rows as the halo around its own slab. The rules are
+ * then executed for the slab only. When every generation is done the
+ * workers write their stats to shared memory, and the coordinator collects
+ * them. The cells are the same as when the world is calculated by a single
+ * process.
+ *
+ * The memory of a worker grows with its slab, not with the world. The
+ * shared memory only holds the halo rings and the stats. The last generation
+ * is only gathered when a frame is asked for, each worker then writes the
+ * shown state of its rows to a pipe of its own, slab after slab.
+ *
+ * Only rules that read nothing but the neighbouring cells can be split, see
+ * hasLocalRules. Workers are processes on the same host, started
+ * with fork().
+ */
+class SlabSimulation {
+ private:
+  WorldSettings world;     ///< how the world is created
+  string evenRuleName;     ///< rule of the even generations
+  string oddRuleName;      ///< rule of the odd generations
+  string ruleMapFileName;  ///< rule map file, empty for none
+  int tileSize;            ///< tile width and height in each slab
+  int processes;           ///< worker processes asked for
+  vector<int> slabStarts;  ///< first row of each slab, and the row after
+  vector<SlabStats> stats;  ///< one entry for each slab of the last run
+
+  /**
+   * @brief Checks that every rule of the world only reads its neighbours
+   * @details The default rules and every rule of the rule map are created
+   * on their own, without any cells.
+   * @return bool true if the world can be split into slabs
+   */
+  bool hasLocalRules();
+
+  /**
+   * @brief Splits the rows of the world, rim included, into slabs
+   * @param height number of rows, rim included
+   */
+  void buildSlabs(int height);
+
+  /**
+   * @brief Calculates a slab, run by its worker process
+   * @param slab index of the slab
+   * @param generations number of generations to calculate
+   * @param downRings rings from each slab to the slab below
+   * @param upRings rings from each slab below to the slab above it
+   * @param pictureFd pipe the shown cells are written to, -1 for none
+   * @param slabStats where the stats of the slab are written
+   */
+  void runSlab(int slab, int generations, vector<HaloRing> &downRings,
+               vector<HaloRing> &upRings, int pictureFd,
+               SlabStats &slabStats);
+
+  /**
+   * @brief Copies a row of a population
+   * @param population the population holding the row
+   * @param row the row
+   * @param cells set to the cells of the row, one for each column
+   */
+  static void copyRow(Population &population, int row, vector<Cell> &cells);
+
+  /**
+   * @brief Overwrites a row of a population
+   * @param population the population holding the row
+   * @param row the row
+   * @param cells the cells of the row, one for each column
+   */
+  static void pasteRow(Population &population, int row,
+                       const vector<Cell> &cells);
+
+ public:
+  /**
+   * @brief Constructor
+   * @param world the file, or the size, seed and share of alive cells
+   * @param evenRuleName rule of the even generations
+   * @param oddRuleName rule of the odd generations, empty for the even rule
+   * @param ruleMapFileName rule map file, empty for none
+   * @param tileSize tile width and height in each slab
+   * @param processes number of worker processes, one per slab
+   */
+  SlabSimulation(const WorldSettings &world, string evenRuleName,
+                 string oddRuleName, string ruleMapFileName, int tileSize,
+                 int processes)
+      : world(world),
+        evenRuleName(std::move(evenRuleName)),
+        oddRuleName(std::move(oddRuleName)),
+        ruleMapFileName(std::move(ruleMapFileName)),
+        tileSize(tileSize),
+        processes(processes) {}
+
+  /**
+   * @brief Calculates the generations in the worker processes
+   * @details Returns when every worker is done. Prints a message and throws
+   * ios_base::failure if the rules can not be split or a worker fails.
+   * @test that the cells are the same as with a single process
+   * @param generations number of generations to calculate
+   * @param frame set to the shown cells of the last generation, nullptr to
+   * only collect the stats
+   */
+  void run(int generations, Frame *frame = nullptr);
+
+  /**
+   * @brief Get what each worker did in the last run
+   * @return vector of SlabStats, one for each slab
+   */
+  const vector<SlabStats> &getStats() const { return stats; }
+};
+
+#endif //GAMEOFLIFE_SLABSIMULATION_H
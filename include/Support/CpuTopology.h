@@ -0,0 +1,101 @@
+/**
+ * @file    CpuTopology.h
+ * @author      Group 11
+ * @date        October 2026
+ * @version     0.3
+ *
+ * @brief This file contains the NUMA nodes of the machine and the CPUs of
+ * each node, used to place the threads calculating the generations.
+*/
+
+#ifndef GAMEOFLIFE_CPUTOPOLOGY_H
+#define GAMEOFLIFE_CPUTOPOLOGY_H
+
+#include <string>
+#include <vector>
+
+using namespace std;
+
+/**
+ * @brief Data structure holding the CPU and NUMA node a worker is placed on.
+ */
+struct WorkerPlacement {
+  int cpu;   ///< CPU the worker is pinned to
+  int node;  ///< NUMA node of the CPU
+};
+
+/**
+ * @brief Data structure holding the cell memory the workers of a NUMA node
+ * have gone through, used to compare the nodes.
+ * @details The bytes are an estimate, the number of cells times sizeof(Cell),
+ * not a measured counter. The nodes of the map and reads of cells on other
+ * nodes are not included.
+ */
+struct NodeStats {
+  int node;                  ///< the NUMA node
+  int threads;               ///< workers placed on the node
+  unsigned long long bytes;  ///< estimated bytes of cells updated and executed
+  double busySeconds;        ///< time the workers spent on the cells
+};
+
+/**
+ * @brief The NUMA nodes of the machine and their CPUs.
+ *
+ * @details Read from /sys/devices/system/node on Linux. Machines without
+ * that information are treated as a single node with every CPU.
+ */
+class CpuTopology {
+ private:
+  vector<int> nodes;           ///< number of each node with CPUs
+  vector<vector<int>> cpus;    ///< CPUs of each node
+
+ public:
+  /**
+   * @brief Constructor, reads the topology of the machine
+   */
+  CpuTopology();
+
+  /**
+   * @brief Constructor with a given topology
+   * @param nodeCpus CPUs of each node, nodes are numbered from 0
+   */
+  explicit CpuTopology(const vector<vector<int>> &nodeCpus);
+
+  /**
+   * @brief Get the number of nodes with CPUs
+   * @return int number of nodes, at least 1
+   */
+  int getNodeCount() const { return static_cast<int>(nodes.size()); }
+
+  /**
+   * @brief Places the workers on the CPUs, node by node
+   * @details Consecutive workers are placed on the same node, and each node
+   * gets a share of the workers that follows its share of the CPUs. Workers
+   * that calculate neighbouring parts of the world then reads each others
+   * cells on the same node, except where two nodes meet. Nodes with more
+   * workers than CPUs reuses their CPUs.
+   * @test That consecutive workers share a node
+   * @param workers number of workers
+   * @return vector of WorkerPlacement, one for each worker
+   */
+  vector<WorkerPlacement> placeWorkers(int workers) const;
+
+  /**
+   * @brief Parses a CPU list such as "0-3,8,10-11"
+   * @test That ranges and single CPUs are read
+   * @param list the CPU list, as in the cpulist files of the kernel
+   * @return vector of CPU numbers
+   */
+  static vector<int> parseCpuList(const string &list);
+
+  /**
+   * @brief Reads the model name of the CPUs of the machine
+   * @details Read from /proc/cpuinfo on Linux, the first CPU is assumed to
+   * be like the others.
+   * @test That a name is returned
+   * @return string the model name, "unknown" if it can not be read
+   */
+  static string readCpuModel();
+};
+
+#endif //GAMEOFLIFE_CPUTOPOLOGY_H
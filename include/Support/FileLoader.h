@@ -8,8 +8,8 @@
  * the contents of specified file.
  *
  * @details Reads startup values from specified file, containing values for
- * WORLD_DIMENSIONS and cell population. Will then create the corresponding
- * cells.
+ * the world dimensions and cell population. Will then create the
+ * corresponding cells.
  */
 
 #ifndef FileLoaderH
@@ -17,7 +17,8 @@
 
 #include <map>
 #include "Cell_Culture/Cell.h"
-#include "Globals.h"
+#include <string>
+#include "SupportStructures.h"
 
 using namespace std;
 
@@ -26,7 +27,7 @@ using namespace std;
  * specified file.
  *
  * @details Reads startup values from specified file, containing values for
- * WORLD_DIMENSIONS and cell Population. Will create the corresponding cells.
+ * world dimensions and cell Population. Will create the corresponding cells.
  * @test this class contains only one public function and a default constructor.
  * Tests will check the functionality of the loadPopulationFromFile() function
  */
@@ -41,10 +42,16 @@ class FileLoader {
 
   /**
    * @brief Load given cell map from file..
-   * @details Loads the given map with cells that is read from the file, pointed
-   * to by the global variable "fileName", opens the file for reading, reads and
-   * loads the read dimension from file and creates the world
+   * @details Loads the given map with cells that is read from the file,
+   * opens the file for reading, reads and loads the read dimension from file
+   * and creates the world. Only the rows from firstRow to lastRow are
+   * created, the file is not read past lastRow.
    * @param cells containing Point and Cell objects.
+   * @param fileName name of the file to read.
+   * @param dimensions set to the width and height read from the file.
+   * @param firstRow first row to create, rim included
+   * @param lastRow last row to create, rim included, -1 for the last row of
+   * the world
    * @test Test to make sure the function throws an ios_base::failure exception
    * @test Test That the file reads the correct dimensions from the file.
    * @test Test to make sure the function calculates the correct amount of rows
@@ -55,7 +62,9 @@ class FileLoader {
    * message with cout and throws an empty exception that is then caught in
    * main.cpp. This cannot be desired behaviour as the class should be silent.
    */
-  void loadPopulationFromFile(map<Point, Cell>& cells);
+  void loadPopulationFromFile(map<Point, Cell>& cells, const string& fileName,
+                              Dimensions& dimensions, int firstRow = 0,
+                              int lastRow = -1);
 };
 
 #endif
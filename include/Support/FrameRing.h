@@ -0,0 +1,86 @@
+/**
+ * @file    FrameRing.h
+ * @author      Group 11
+ * @date        October 2026
+ * @version     0.3
+ *
+ * @brief This file contains a ring of frames passed from the simulation
+ * thread to the thread presenting them.
+*/
+
+#ifndef GAMEOFLIFE_FRAMERING_H
+#define GAMEOFLIFE_FRAMERING_H
+
+#include <atomic>
+#include <vector>
+#include "Cell_Culture/Frame.h"
+
+using namespace std;
+
+/**
+ * @brief Lock free ring of frames with a single producer and a single
+ * consumer.
+ *
+ * @details The frames are owned by the ring and reused, so no memory is
+ * allocated once every slot has been written. The producer fills the slot
+ * from beginWrite() and makes it visible with publish(). A published frame is
+ * never changed until the consumer has released it. The consumer only wants
+ * the newest frame; acquireLatest() skips the frames published before it.
+ * If the consumer falls behind and the ring is full, beginWrite() returns
+ * nullptr and the producer skips the frame instead of waiting.
+ */
+class FrameRing {
+ private:
+  vector<Frame> slots;          ///< the frames, reused
+  atomic<size_t> readCount;     ///< frames released by the consumer
+  atomic<size_t> writeCount;    ///< frames published by the producer
+  unsigned long droppedFrames;  ///< frames skipped by the consumer
+  unsigned long skippedFrames;  ///< frames not written, the ring was full
+
+ public:
+  /**
+   * @brief Constructor
+   * @param capacity number of frames in the ring, at least 2
+   */
+  explicit FrameRing(size_t capacity);
+
+  /**
+   * @brief Producer, get the slot to write the next frame to
+   * @test That nullptr is returned when the ring is full
+   * @return Frame pointer to the slot, or nullptr if the ring is full
+   */
+  Frame *beginWrite();
+
+  /**
+   * @brief Producer, makes the frame from beginWrite() visible
+   */
+  void publish();
+
+  /**
+   * @brief Consumer, get the newest published frame
+   * @details Older frames are released, and counted as dropped. The frame
+   * stays valid until release() is called.
+   * @test That the newest frame is returned and older frames are dropped
+   * @return Frame pointer to the newest frame, or nullptr if there is none
+   */
+  const Frame *acquireLatest();
+
+  /**
+   * @brief Consumer, gives the frame from acquireLatest() back to the ring
+   */
+  void release();
+
+  /**
+   * @brief Get the number of frames the consumer skipped
+   * @return unsigned long dropped frames
+   */
+  unsigned long getDroppedFrames() const { return droppedFrames; }
+
+  /**
+   * @brief Get the number of frames the producer skipped, the ring was full
+   * @return unsigned long skipped frames
+   */
+  unsigned long getSkippedFrames() const { return skippedFrames; }
+};
+
+#endif //GAMEOFLIFE_FRAMERING_H
@@ -0,0 +1,150 @@
+/**
+ * @file    GenerationSnapshots.h
+ * @author      Group 11
+ * @date        October 2026
+ * @version     0.3
+ *
+ * @brief This file contains snapshots of the generations that other threads
+ * can read while the simulation advances.
+*/
+
+#ifndef GAMEOFLIFE_GENERATIONSNAPSHOTS_H
+#define GAMEOFLIFE_GENERATIONSNAPSHOTS_H
+
+#include <atomic>
+#include <vector>
+#include "Cell_Culture/Frame.h"
+
+using namespace std;
+
+class GenerationSnapshots;
+
+/**
+ * @brief A generation pinned by a reader.
+ *
+ * @details The frame stays unchanged for as long as the reader holds it.
+ * It is released when the object is destroyed, or by release(). The object
+ * can be moved but not copied.
+ */
+class PinnedFrame {
+ private:
+  GenerationSnapshots *owner;  ///< the snapshots the frame belongs to
+  int slot;                    ///< slot of the frame, -1 if nothing is pinned
+
+ public:
+  /**
+   * @brief Constructor, used by GenerationSnapshots::pin
+   * @param owner the snapshots the frame belongs to, nullptr for none
+   * @param slot slot of the pinned frame
+   */
+  PinnedFrame(GenerationSnapshots *owner = nullptr, int slot = -1)
+      : owner(owner), slot(slot) {}
+
+  PinnedFrame(const PinnedFrame &) = delete;
+  PinnedFrame &operator=(const PinnedFrame &) = delete;
+
+  /**
+   * @brief Move constructor, the other object no longer pins the frame
+   * @param other the pinned frame to take over
+   */
+  PinnedFrame(PinnedFrame &&other) noexcept
+      : owner(other.owner), slot(other.slot) {
+    other.slot = -1;
+  }
+
+  /**
+   * @brief Move assignment, releases the current frame first
+   * @param other the pinned frame to take over
+   * @return PinnedFrame this object
+   */
+  PinnedFrame &operator=(PinnedFrame &&other) noexcept;
+
+  /// @brief Destructor, releases the frame
+  ~PinnedFrame() { release(); }
+
+  /**
+   * @brief Releases the frame, the buffer may be reused by the simulation
+   */
+  void release();
+
+  /**
+   * @brief Get the pinned frame
+   * @return Frame pointer, nullptr if nothing is pinned
+   */
+  const Frame *get() const;
+
+  /// @brief Access the pinned frame, which must exist
+  const Frame *operator->() const { return get(); }
+
+  /// @brief If a frame is pinned
+  explicit operator bool() const { return slot >= 0; }
+};
+
+/**
+ * @brief Buffers of published generations, where each buffer is kept
+ * unchanged while any reader has pinned it.
+ *
+ * @details Works as read-copy-update: the simulation writes a new
+ * generation into a buffer no reader holds, and then publishes it as the
+ * current one. Readers pin the current buffer without taking a lock and
+ * without copying it. A buffer is only reused once it is neither current
+ * nor pinned. If every buffer is pinned the simulation skips publishing the
+ * generation, it never waits for the readers.
+ */
+class GenerationSnapshots {
+ private:
+  friend class PinnedFrame;
+
+  /// @brief A buffer and the number of readers pinning it
+  struct Slot {
+    Frame frame;            ///< the generation
+    atomic<int> readers;    ///< readers pinning the generation
+  };
+
+  vector<Slot> slots;         ///< the buffers, never reallocated
+  atomic<int> current;        ///< slot of the current generation, -1 if none
+  int writing;                ///< slot being written by the simulation
+  unsigned long skippedGenerations;  ///< generations not published
+
+  /**
+   * @brief Unpins a slot
+   * @param slot slot of the frame to release
+   */
+  void unpin(int slot) { slots[slot].readers--; }
+
+ public:
+  /**
+   * @brief Constructor
+   * @param buffers number of buffers, at least 2
+   */
+  explicit GenerationSnapshots(int buffers);
+
+  /**
+   * @brief Simulation, get a buffer to write the next generation to
+   * @test That a pinned buffer is never returned
+   * @return Frame pointer to the buffer, nullptr if every buffer is in use
+   */
+  Frame *beginWrite();
+
+  /**
+   * @brief Simulation, makes the buffer from beginWrite() the current one
+   */
+  void publish();
+
+  /**
+   * @brief Reader, pins the current generation
+   * @details May be called from any thread, without locking.
+   * @test That the pinned frame is not changed by later generations
+   * @return PinnedFrame the current generation, empty if none is published
+   */
+  PinnedFrame pin();
+
+  /**
+   * @brief Get the number of generations not published, every buffer was
+   * pinned
+   * @return unsigned long skipped generations
+   */
+  unsigned long getSkippedGenerations() const { return skippedGenerations; }
+};
+
+#endif //GAMEOFLIFE_GENERATIONSNAPSHOTS_H
@@ -0,0 +1,88 @@
+/**
+ * @file    HaloRing.h
+ * @author      Group 11
+ * @date        October 2026
+ * @version     0.3
+ *
+ * @brief This file contains a ring of halo rows passed between two processes
+ * through shared memory.
+*/
+
+#ifndef GAMEOFLIFE_HALORING_H
+#define GAMEOFLIFE_HALORING_H
+
+#include <atomic>
+#include <cstddef>
+#include "Cell_Culture/Cell.h"
+
+using namespace std;
+
+/**
+ * @brief Ring of rows of cells with a single producer and a single consumer,
+ * placed in memory shared by both.
+ *
+ * @details The ring does not own its memory, it is handed a block of at
+ * least getSize() bytes that both processes can reach at the same address,
+ * such as an anonymous shared mapping created before fork(). The counters
+ * are lock free atomics in the block, so the ring works across processes.
+ * The producer waits while the ring is full and the consumer while it is
+ * empty. Both stop waiting with an ios_base::failure if the abort flag is
+ * set, so a failing process does not leave its neighbours waiting forever.
+ */
+class HaloRing {
+ private:
+  /// @brief Counters at the start of the shared block
+  struct Counters {
+    atomic<unsigned long> writeCount;  ///< rows pushed by the producer
+    atomic<unsigned long> readCount;   ///< rows popped by the consumer
+  };
+
+  Counters *counters;          ///< counters in the shared block
+  Cell *rows;                  ///< the rows, after the counters
+  size_t rowCells;             ///< cells in each row
+  size_t slots;                ///< rows the ring holds
+  const atomic<int> *aborted;  ///< set when a process has failed
+
+  /**
+   * @brief Throws if the processes are aborted, yields otherwise
+   */
+  void waitOnce() const;
+
+ public:
+  /**
+   * @brief Get the bytes a ring needs
+   * @param rowCells cells in each row
+   * @param slots rows the ring holds
+   * @return size_t bytes of shared memory
+   */
+  static size_t getSize(size_t rowCells, size_t slots);
+
+  /**
+   * @brief Constructor, sets up an empty ring in the block
+   * @details Must be done once, before the processes start using the ring.
+   * @param memory block of getSize() bytes, aligned for the counters
+   * @param rowCells cells in each row
+   * @param slots rows the ring holds, at least 1
+   * @param aborted flag that stops the waiting, nullptr for none
+   */
+  HaloRing(void *memory, size_t rowCells, size_t slots,
+           const atomic<int> *aborted = nullptr);
+
+  /**
+   * @brief Producer, copies a row into the ring, waits while it is full
+   * @test That rows are popped in the order they are pushed
+   * @param row rowCells cells
+   */
+  void push(const Cell *row);
+
+  /**
+   * @brief Consumer, copies the oldest row out of the ring, waits while it
+   * is empty
+   * @test That a row pushed by another process is popped
+   * @param row set to rowCells cells
+   * @return double seconds spent waiting for the row
+   */
+  double pop(Cell *row);
+};
+
+#endif //GAMEOFLIFE_HALORING_H
@@ -24,8 +24,10 @@
 #include <sstream>
 #include <string>
 #include <utility>
-#include "Globals.h"
+#include "SupportStructures.h"
 #include "ScreenPrinter.h"
+#include "ImageExporter.h"
+#include "FrameStreamer.h"
 
 using namespace std;
 /// @brief Data structure holding base app values that modifies how the program
@@ -34,9 +36,55 @@ struct ApplicationValues {
   bool runSimulation =
       true;  ///< Bool controlling if the program should be run or not.
   string evenRuleName,       ///< Strings holding even rule name
-      oddRuleName;           ///< Strings holding odd rule name
+      oddRuleName,           ///< Strings holding odd rule name
+      ruleMapFileName,       ///< String holding name of the rule map file
+      pluginDirectory;       ///< String holding directory to load plugins from
   int maxGenerations = 100;  ///< Int holding the number of max generations to
                              /// be run, default= 100
+  int generationsPerSweep = 1;  ///< Int holding the generations advanced
+                                /// per sweep, 1 or 2, default= 1
+  int threadCount = 1;  ///< Int holding the number of threads calculating
+                        /// the generations, default= 1
+  bool workStealing = false;  ///< Bool controlling if tiles are scheduled by
+                              /// work stealing, default= false
+  bool pinThreads = false;  ///< Bool controlling if the threads are pinned to
+                            /// the NUMA nodes, default= false
+  int processCount = 1;  ///< Int holding the number of worker processes
+                         /// calculating slabs of the world, default= 1
+  WorldSettings world;  ///< Size, file, seed and share of alive cells of the
+                        /// world, default= random 80x24, seed from the
+                        /// clock, 0.5
+  bool autotune = false;  ///< Bool controlling if the threads and tile size
+                          /// are chosen by timing candidates, default= false
+  bool headless = false;  ///< Bool controlling if the simulation runs without
+                          /// presenting it, default= false
+  string exportDirectory;  ///< String holding the directory the generations
+                          /// are exported to, default= empty (no export)
+  int exportEvery = 1;  ///< Int holding the generations between two exported
+                        /// images, default= 1
+  ImageFormat exportFormat = ImageFormat::PPM;  ///< Format of the exported
+                                                /// images, default= PPM
+  string streamPath;  ///< String holding the file or named pipe the frames
+                     /// are streamed to, "-" for the standard output,
+                     /// default= empty (printed)
+  PixelFormat streamFormat = PixelFormat::RGB;  ///< Pixel format of the
+                                                /// streamed frames,
+                                                /// default= RGB
+  bool synchronizedOutput = false;  ///< Bool controlling if the frames are
+                                    /// shown on the alternate screen with
+                                    /// synchronized updates, default= false
+  double framesPerSecond = 0.0;  ///< Double holding the target frames printed
+                                 /// per second, default= 0 (as fast as possible)
+  double generationsPerSecond = 0.0;  ///< Double holding the target
+                                      /// generations per second, default= 0
+                                      /// (as fast as possible)
+  DownsampleMode downsampleMode = DownsampleMode::CELLS;  ///< How the cells
+                                                         /// are shown,
+                                                         /// default= CELLS
+  Viewport viewport{0, 0, 1};  ///< Part of the world shown when downsampled,
+                               /// default= from the upper left, zoom 1
+  int ensembleSeeds = 0;  ///< Int holding the number of seeds simulated
+                          /// without presenting them, default= 0 (off)
 };
 
 /**
@@ -207,8 +255,8 @@ class WorldsizeArgument : public BaseArgument {
    * passed, the simulation will not run.
    * @param appValues struct holding application Values
    * @param dimensions holding the size the world will have.
-   * @test Test that the function sets WORLD_DIMENSTIONS.WIDTH and .HEIGHT to
-   * the correct value.
+   * @test Test that the function sets appValue world.dimensions to the
+   * correct value.
    * @test Test that exception is thrown if the argument is passed with no
    * value.
    * @test Test that an exception is thrown if the user has entered invalid
@@ -251,7 +299,7 @@ class FileArgument : public BaseArgument {
 
   /**
    * @brief Sets the filename to read from.
-   * @details Changes the global variable fileName to input
+   * @details Changes the appValue world.fileName to input
    * value to read a worldSize and population from. If no value is passed,
    * the simulation will not run.
    * @param appValues struct holding application Values
@@ -353,4 +401,843 @@ class OddRuleArgument : public BaseArgument {
   void execute(ApplicationValues& appValues, char* oddRule) override;
 };
 
+/**
+ * @brief This class handles the rule map argument if passed by the user.
+ * @details Derived class from BaseArgument. Is responsible for
+ * setting the file with rules for regions of the world.
+ * @test Test the constructor when given the -rm argument.
+ * @test Test the Execute function.
+ */
+class RuleMapArgument : public BaseArgument {
+ public:
+  /**
+   * @brief Default constructor for the derived RuleMapArgument class
+   * @details BaseArgument constructor is used to set inherited argValue.
+   * @test That an object can be created and that the getValue() function
+   * returns the correct argValue.
+   */
+  RuleMapArgument() : BaseArgument("-rm") {}
+  /**
+   * @brief Overriden destructor for RuleMapArgument class.
+   * @details Overriden default destructor for a derived class.
+   * @test No recommended tests at this time.
+   */
+  ~RuleMapArgument() override = default;
+  /**
+   * @brief Sets the file to read rules for regions of the world from.
+   * @details Changes the default appValue for ruleMapFileName to input
+   * value. If no value is passed, the simulation will not run.
+   * @param appValues struct holding application Values
+   * @param ruleMapFile holding the name of the rule map file.
+   * @test Pass default ApplicationValues object and a given value, test that
+   * the function sets ruleMapFileName to the correct value.
+   * @test Test that the bool runSimulation is set to false if argument is
+   * passed with no value.
+   */
+  void execute(ApplicationValues& appValues, char* ruleMapFile) override;
+};
+
+/**
+ * @brief This class handles the plugin directory argument if passed by the
+ * user.
+ * @details Derived class from BaseArgument. Is responsible for
+ * setting the directory rule plugins are loaded from.
+ * @test Test the constructor when given the -pd argument.
+ * @test Test the Execute function.
+ */
+class PluginDirectoryArgument : public BaseArgument {
+ public:
+  /**
+   * @brief Default constructor for the derived PluginDirectoryArgument class
+   * @details BaseArgument constructor is used to set inherited argValue.
+   * @test That an object can be created and that the getValue() function
+   * returns the correct argValue.
+   */
+  PluginDirectoryArgument() : BaseArgument("-pd") {}
+  /**
+   * @brief Overriden destructor for PluginDirectoryArgument class.
+   * @details Overriden default destructor for a derived class.
+   * @test No recommended tests at this time.
+   */
+  ~PluginDirectoryArgument() override = default;
+  /**
+   * @brief Sets the directory to load rule plugins from.
+   * @details Changes the default appValue for pluginDirectory to input
+   * value. If no value is passed, the simulation will not run.
+   * @param appValues struct holding application Values
+   * @param directory holding the path of the plugin directory.
+   * @test Pass default ApplicationValues object and a given value, test that
+   * the function sets pluginDirectory to the correct value.
+   * @test Test that the bool runSimulation is set to false if argument is
+   * passed with no value.
+   */
+  void execute(ApplicationValues& appValues, char* directory) override;
+};
+
+/**
+ * @brief This class handles the generations per sweep argument if passed by
+ * the user.
+ * @details Derived class from BaseArgument. Is responsible for
+ * setting how many generations each sweep over the world advances.
+ * @test Test the constructor when given the -gs argument.
+ * @test Test the Execute function.
+ */
+class GenerationsPerSweepArgument : public BaseArgument {
+ public:
+  /**
+   * @brief Default constructor for the derived GenerationsPerSweepArgument
+   * class
+   * @details BaseArgument constructor is used to set inherited argValue.
+   * @test That an object can be created and that the getValue() function
+   * returns the correct argValue.
+   */
+  GenerationsPerSweepArgument() : BaseArgument("-gs") {}
+  /**
+   * @brief Overriden destructor for GenerationsPerSweepArgument class.
+   * @details Overriden default destructor for a derived class.
+   * @test No recommended tests at this time.
+   */
+  ~GenerationsPerSweepArgument() override = default;
+  /**
+   * @brief Sets the generations advanced per sweep.
+   * @details Changes the default appValue for generationsPerSweep to input
+   * value. If no value is passed, the simulation will not run.
+   * @param appValues struct holding application Values
+   * @param generations holding the generations per sweep, 1 or 2.
+   * @test Pass default ApplicationValues object and a given value, test that
+   * the function sets generationsPerSweep to the correct value.
+   * @test Test that the bool runSimulation is set to false if argument is
+   * passed with no value.
+   */
+  void execute(ApplicationValues& appValues, char* generations) override;
+};
+
+/**
+ * @brief This class handles the thread count argument if passed by the user.
+ * @details Derived class from BaseArgument. Is responsible for
+ * setting how many threads calculates the generations.
+ * @test Test the constructor when given the -t argument.
+ * @test Test the Execute function.
+ */
+class ThreadCountArgument : public BaseArgument {
+ public:
+  /**
+   * @brief Default constructor for the derived ThreadCountArgument class
+   * @details BaseArgument constructor is used to set inherited argValue.
+   * @test That an object can be created and that the getValue() function
+   * returns the correct argValue.
+   */
+  ThreadCountArgument() : BaseArgument("-t") {}
+  /**
+   * @brief Overriden destructor for ThreadCountArgument class.
+   * @details Overriden default destructor for a derived class.
+   * @test No recommended tests at this time.
+   */
+  ~ThreadCountArgument() override = default;
+  /**
+   * @brief Sets the number of threads calculating the generations.
+   * @details Changes the default appValue for threadCount to input
+   * value. If no value is passed, the simulation will not run.
+   * @param appValues struct holding application Values
+   * @param threads holding the number of threads.
+   * @test Pass default ApplicationValues object and a given value, test that
+   * the function sets threadCount to the correct value.
+   * @test Test that the bool runSimulation is set to false if argument is
+   * passed with no value.
+   */
+  void execute(ApplicationValues& appValues, char* threads) override;
+};
+
+/**
+ * @brief This class handles the scheduler argument if passed by the user.
+ * @details Derived class from BaseArgument. Is responsible for
+ * setting how the tiles are scheduled on the threads, bands or stealing.
+ * @test Test the constructor when given the -sc argument.
+ * @test Test the Execute function.
+ */
+class SchedulerArgument : public BaseArgument {
+ public:
+  /**
+   * @brief Default constructor for the derived SchedulerArgument class
+   * @details BaseArgument constructor is used to set inherited argValue.
+   * @test That an object can be created and that the getValue() function
+   * returns the correct argValue.
+   */
+  SchedulerArgument() : BaseArgument("-sc") {}
+  /**
+   * @brief Overriden destructor for SchedulerArgument class.
+   * @details Overriden default destructor for a derived class.
+   * @test No recommended tests at this time.
+   */
+  ~SchedulerArgument() override = default;
+  /**
+   * @brief Sets how the tiles are scheduled on the threads.
+   * @details Sets the appValue workStealing if the value is "stealing". If
+   * no value, or an unknown value, is passed, the simulation will not run.
+   * @param appValues struct holding application Values
+   * @param scheduler holding the name of the scheduler.
+   * @test Pass default ApplicationValues object and a given value, test that
+   * the function sets workStealing to the correct value.
+   * @test Test that the bool runSimulation is set to false if argument is
+   * passed with no value.
+   */
+  void execute(ApplicationValues& appValues, char* scheduler) override;
+};
+
+/**
+ * @brief This class handles the thread pinning argument if passed by the user.
+ * @details Derived class from BaseArgument. Is responsible for
+ * pinning the threads to the CPUs of the NUMA nodes, "on" or "off".
+ * @test Test the constructor when given the -pt argument.
+ * @test Test the Execute function.
+ */
+class PinThreadsArgument : public BaseArgument {
+ public:
+  /**
+   * @brief Default constructor for the derived PinThreadsArgument class
+   * @details BaseArgument constructor is used to set inherited argValue.
+   * @test That an object can be created and that the getValue() function
+   * returns the correct argValue.
+   */
+  PinThreadsArgument() : BaseArgument("-pt") {}
+  /**
+   * @brief Overriden destructor for PinThreadsArgument class.
+   * @details Overriden default destructor for a derived class.
+   * @test No recommended tests at this time.
+   */
+  ~PinThreadsArgument() override = default;
+  /**
+   * @brief Sets if the threads are pinned to the NUMA nodes.
+   * @details Sets the appValue pinThreads if the value is "on". If no value,
+   * or an unknown value, is passed, the simulation will not run.
+   * @param appValues struct holding application Values
+   * @param pinning holding "on" or "off".
+   * @test Pass default ApplicationValues object and a given value, test that
+   * the function sets pinThreads to the correct value.
+   * @test Test that the bool runSimulation is set to false if argument is
+   * passed with no value.
+   */
+  void execute(ApplicationValues& appValues, char* pinning) override;
+};
+
+/**
+ * @brief This class handles the process count argument if passed by the user.
+ * @details Derived class from BaseArgument. Is responsible for
+ * the number of worker processes calculating slabs of the world.
+ * @test Test the constructor when given the -pr argument.
+ * @test Test the Execute function.
+ */
+class ProcessCountArgument : public BaseArgument {
+ public:
+  /**
+   * @brief Default constructor for the derived ProcessCountArgument class
+   * @details BaseArgument constructor is used to set inherited argValue.
+   * @test That an object can be created and that the getValue() function
+   * returns the correct argValue.
+   */
+  ProcessCountArgument() : BaseArgument("-pr") {}
+  /**
+   * @brief Overriden destructor for ProcessCountArgument class.
+   * @details Overriden default destructor for a derived class.
+   * @test No recommended tests at this time.
+   */
+  ~ProcessCountArgument() override = default;
+  /**
+   * @brief Sets the number of worker processes.
+   * @details Changes the default appValue for int processCount to input
+   * value. If no value is passed, the simulation will not run.
+   * @param appValues struct holding application Values
+   * @param processes holding the number of processes.
+   * @test Pass default ApplicationValues object and a given value, test that
+   * the function sets processCount to the given value.
+   * @test Test that the bool runSimulation is set to false if argument is
+   * passed with no value.
+   */
+  void execute(ApplicationValues& appValues, char* processes) override;
+};
+
+/**
+ * @brief This class handles the random seed argument if passed by the user.
+ * @details Derived class from BaseArgument. Is responsible for
+ * the seed the random world is filled from.
+ * @test Test the constructor when given the -sd argument.
+ * @test Test the Execute function.
+ */
+class RandomSeedArgument : public BaseArgument {
+ public:
+  /**
+   * @brief Default constructor for the derived RandomSeedArgument class
+   * @details BaseArgument constructor is used to set inherited argValue.
+   * @test That an object can be created and that the getValue() function
+   * returns the correct argValue.
+   */
+  RandomSeedArgument() : BaseArgument("-sd") {}
+  /**
+   * @brief Overriden destructor for RandomSeedArgument class.
+   * @details Overriden default destructor for a derived class.
+   * @test No recommended tests at this time.
+   */
+  ~RandomSeedArgument() override = default;
+  /**
+   * @brief Sets the seed of the random world.
+   * @details Changes the appValue world.randomFill.seed to the input value. If no value
+   * is passed, the simulation will not run.
+   * @param appValues struct holding application Values
+   * @param seed holding the seed.
+   * @test Pass default ApplicationValues object and a given value, test that
+   * the function sets world.randomFill.seed to the given value.
+   * @test Test that the bool runSimulation is set to false if argument is
+   * passed with no value.
+   */
+  void execute(ApplicationValues& appValues, char* seed) override;
+};
+
+/**
+ * @brief This class handles the live density argument if passed by the user.
+ * @details Derived class from BaseArgument. Is responsible for
+ * the share of alive cells in the random world.
+ * @test Test the constructor when given the -dn argument.
+ * @test Test the Execute function.
+ */
+class LiveDensityArgument : public BaseArgument {
+ public:
+  /**
+   * @brief Default constructor for the derived LiveDensityArgument class
+   * @details BaseArgument constructor is used to set inherited argValue.
+   * @test That an object can be created and that the getValue() function
+   * returns the correct argValue.
+   */
+  LiveDensityArgument() : BaseArgument("-dn") {}
+  /**
+   * @brief Overriden destructor for LiveDensityArgument class.
+   * @details Overriden default destructor for a derived class.
+   * @test No recommended tests at this time.
+   */
+  ~LiveDensityArgument() override = default;
+  /**
+   * @brief Sets the share of alive cells of the random world.
+   * @details Changes the appValue world.randomFill.liveDensity to the input value. If no
+   * value, or a value outside 0 to 1, is passed, the simulation will not run.
+   * @param appValues struct holding application Values
+   * @param density holding the share, 0 to 1.
+   * @test Pass default ApplicationValues object and a given value, test that
+   * the function sets world.randomFill.liveDensity to the given value.
+   * @test Test that the bool runSimulation is set to false if argument is
+   * passed with no value.
+   */
+  void execute(ApplicationValues& appValues, char* density) override;
+};
+
+/**
+ * @brief This class handles the ensemble argument if passed by the user.
+ * @details Derived class from BaseArgument. Is responsible for
+ * the number of seeds simulated without presenting them.
+ * @test Test the constructor when given the -en argument.
+ * @test Test the Execute function.
+ */
+class EnsembleArgument : public BaseArgument {
+ public:
+  /**
+   * @brief Default constructor for the derived EnsembleArgument class
+   * @details BaseArgument constructor is used to set inherited argValue.
+   * @test That an object can be created and that the getValue() function
+   * returns the correct argValue.
+   */
+  EnsembleArgument() : BaseArgument("-en") {}
+  /**
+   * @brief Overriden destructor for EnsembleArgument class.
+   * @details Overriden default destructor for a derived class.
+   * @test No recommended tests at this time.
+   */
+  ~EnsembleArgument() override = default;
+  /**
+   * @brief Sets the number of seeds of the ensemble.
+   * @details Changes the default appValue for int ensembleSeeds to input
+   * value. If no value, or a value below 1, is passed, the simulation will
+   * not run.
+   * @param appValues struct holding application Values
+   * @param seeds holding the number of seeds.
+   * @test Pass default ApplicationValues object and a given value, test that
+   * the function sets ensembleSeeds to the given value.
+   * @test Test that the bool runSimulation is set to false if argument is
+   * passed with no value.
+   */
+  void execute(ApplicationValues& appValues, char* seeds) override;
+};
+
+/**
+ * @brief This class handles the autotune argument if passed by the user.
+ * @details Derived class from BaseArgument. Is responsible for
+ * choosing the threads and tile size by timing candidates, "on" or "off".
+ * @test Test the constructor when given the -at argument.
+ * @test Test the Execute function.
+ */
+class AutotuneArgument : public BaseArgument {
+ public:
+  /**
+   * @brief Default constructor for the derived AutotuneArgument class
+   * @details BaseArgument constructor is used to set inherited argValue.
+   * @test That an object can be created and that the getValue() function
+   * returns the correct argValue.
+   */
+  AutotuneArgument() : BaseArgument("-at") {}
+  /**
+   * @brief Overriden destructor for AutotuneArgument class.
+   * @details Overriden default destructor for a derived class.
+   * @test No recommended tests at this time.
+   */
+  ~AutotuneArgument() override = default;
+  /**
+   * @brief Sets if the threads and tile size are autotuned.
+   * @details Sets the appValue autotune if the value is "on". If no value,
+   * or an unknown value, is passed, the simulation will not run.
+   * @param appValues struct holding application Values
+   * @param autotune holding "on" or "off".
+   * @test Pass default ApplicationValues object and a given value, test that
+   * the function sets autotune to the correct value.
+   * @test Test that the bool runSimulation is set to false if argument is
+   * passed with no value.
+   */
+  void execute(ApplicationValues& appValues, char* autotune) override;
+};
+
+/**
+ * @brief This class handles the headless argument if passed by the user.
+ * @details Derived class from BaseArgument. Is responsible for
+ * running the simulation without presenting it, "on" or "off".
+ * @test Test the constructor when given the -hl argument.
+ * @test Test the Execute function.
+ */
+class HeadlessArgument : public BaseArgument {
+ public:
+  /**
+   * @brief Default constructor for the derived HeadlessArgument class
+   * @details BaseArgument constructor is used to set inherited argValue.
+   * @test That an object can be created and that the getValue() function
+   * returns the correct argValue.
+   */
+  HeadlessArgument() : BaseArgument("-hl") {}
+  /**
+   * @brief Overriden destructor for HeadlessArgument class.
+   * @details Overriden default destructor for a derived class.
+   * @test No recommended tests at this time.
+   */
+  ~HeadlessArgument() override = default;
+  /**
+   * @brief Sets if the simulation runs without presenting it.
+   * @details Sets the appValue headless if the value is "on". If no value,
+   * or an unknown value, is passed, the simulation will not run.
+   * @param appValues struct holding application Values
+   * @param headless holding "on" or "off".
+   * @test Pass default ApplicationValues object and a given value, test that
+   * the function sets headless to the correct value.
+   * @test Test that the bool runSimulation is set to false if argument is
+   * passed with no value.
+   */
+  void execute(ApplicationValues& appValues, char* headless) override;
+};
+
+/**
+ * @brief This class handles the frames per second argument if passed by the user.
+ * @details Derived class from BaseArgument. Is responsible for
+ * the target number of frames printed per second.
+ * @test Test the constructor when given the -fps argument.
+ * @test Test the Execute function.
+ */
+class FramesPerSecondArgument : public BaseArgument {
+ public:
+  /**
+   * @brief Default constructor for the derived FramesPerSecondArgument class
+   * @details BaseArgument constructor is used to set inherited argValue.
+   * @test That an object can be created and that the getValue() function
+   * returns the correct argValue.
+   */
+  FramesPerSecondArgument() : BaseArgument("-fps") {}
+  /**
+   * @brief Overriden destructor for FramesPerSecondArgument class.
+   * @details Overriden default destructor for a derived class.
+   * @test No recommended tests at this time.
+   */
+  ~FramesPerSecondArgument() override = default;
+  /**
+   * @brief Sets the target frames printed per second.
+   * @details Changes the default appValue for double framesPerSecond to input
+   * value. If no value, or a negative value, is passed, the simulation will
+   * not run.
+   * @param appValues struct holding application Values
+   * @param rate holding the frames printed per second, 0 for as fast as possible.
+   * @test Pass default ApplicationValues object and a given value, test that
+   * the function sets framesPerSecond to the given value.
+   * @test Test that the bool runSimulation is set to false if argument is
+   * passed with no value.
+   */
+  void execute(ApplicationValues& appValues, char* rate) override;
+};
+
+/**
+ * @brief This class handles the generations per second argument if passed by the user.
+ * @details Derived class from BaseArgument. Is responsible for
+ * the target number of generations calculated per second.
+ * @test Test the constructor when given the -gps argument.
+ * @test Test the Execute function.
+ */
+class GenerationsPerSecondArgument : public BaseArgument {
+ public:
+  /**
+   * @brief Default constructor for the derived GenerationsPerSecondArgument class
+   * @details BaseArgument constructor is used to set inherited argValue.
+   * @test That an object can be created and that the getValue() function
+   * returns the correct argValue.
+   */
+  GenerationsPerSecondArgument() : BaseArgument("-gps") {}
+  /**
+   * @brief Overriden destructor for GenerationsPerSecondArgument class.
+   * @details Overriden default destructor for a derived class.
+   * @test No recommended tests at this time.
+   */
+  ~GenerationsPerSecondArgument() override = default;
+  /**
+   * @brief Sets the target generations calculated per second.
+   * @details Changes the default appValue for double generationsPerSecond to input
+   * value. If no value, or a negative value, is passed, the simulation will
+   * not run.
+   * @param appValues struct holding application Values
+   * @param rate holding the generations calculated per second, 0 for as fast as possible.
+   * @test Pass default ApplicationValues object and a given value, test that
+   * the function sets generationsPerSecond to the given value.
+   * @test Test that the bool runSimulation is set to false if argument is
+   * passed with no value.
+   */
+  void execute(ApplicationValues& appValues, char* rate) override;
+};
+
+/**
+ * @brief This class handles the downsampling argument if passed by the user.
+ * @details Derived class from BaseArgument. Is responsible for
+ * how the cells are shown, "cells", "half" or "braille".
+ * @test Test the constructor when given the -ds argument.
+ * @test Test the Execute function.
+ */
+class DownsampleArgument : public BaseArgument {
+ public:
+  /**
+   * @brief Default constructor for the derived DownsampleArgument class
+   * @details BaseArgument constructor is used to set inherited argValue.
+   * @test That an object can be created and that the getValue() function
+   * returns the correct argValue.
+   */
+  DownsampleArgument() : BaseArgument("-ds") {}
+  /**
+   * @brief Overriden destructor for DownsampleArgument class.
+   * @details Overriden default destructor for a derived class.
+   * @test No recommended tests at this time.
+   */
+  ~DownsampleArgument() override = default;
+  /**
+   * @brief Sets how the cells are shown.
+   * @details Changes the appValue downsampleMode to the given mode. If no
+   * value, or an invalid value, is passed, the simulation will not run.
+   * @param appValues struct holding application Values
+   * @param mode holding "cells", "half" or "braille".
+   * @test Pass default ApplicationValues object and a given value, test that
+   * the function sets downsampleMode to the given value.
+   * @test Test that the bool runSimulation is set to false if argument is
+   * passed with no value.
+   */
+  void execute(ApplicationValues& appValues, char* mode) override;
+};
+
+/**
+ * @brief This class handles the viewport argument if passed by the user.
+ * @details Derived class from BaseArgument. Is responsible for
+ * the first column and row of the world shown when downsampled.
+ * @test Test the constructor when given the -vp argument.
+ * @test Test the Execute function.
+ */
+class ViewportArgument : public BaseArgument {
+ public:
+  /**
+   * @brief Default constructor for the derived ViewportArgument class
+   * @details BaseArgument constructor is used to set inherited argValue.
+   * @test That an object can be created and that the getValue() function
+   * returns the correct argValue.
+   */
+  ViewportArgument() : BaseArgument("-vp") {}
+  /**
+   * @brief Overriden destructor for ViewportArgument class.
+   * @details Overriden default destructor for a derived class.
+   * @test No recommended tests at this time.
+   */
+  ~ViewportArgument() override = default;
+  /**
+   * @brief Sets the upper left corner of the viewport.
+   * @details Changes the appValues viewport.column and viewport.row to the
+   * input value, in the format columnxrow. If no value, or an invalid value,
+   * is passed, the simulation will not run.
+   * @param appValues struct holding application Values
+   * @param corner holding the column and row.
+   * @test Pass default ApplicationValues object and a given value, test that
+   * the function sets viewport.column and viewport.row to the given value.
+   * @test Test that the bool runSimulation is set to false if argument is
+   * passed with no value.
+   */
+  void execute(ApplicationValues& appValues, char* corner) override;
+};
+
+/**
+ * @brief This class handles the zoom argument if passed by the user.
+ * @details Derived class from BaseArgument. Is responsible for
+ * the width and height in cells of each dot when downsampled.
+ * @test Test the constructor when given the -zm argument.
+ * @test Test the Execute function.
+ */
+class ZoomArgument : public BaseArgument {
+ public:
+  /**
+   * @brief Default constructor for the derived ZoomArgument class
+   * @details BaseArgument constructor is used to set inherited argValue.
+   * @test That an object can be created and that the getValue() function
+   * returns the correct argValue.
+   */
+  ZoomArgument() : BaseArgument("-zm") {}
+  /**
+   * @brief Overriden destructor for ZoomArgument class.
+   * @details Overriden default destructor for a derived class.
+   * @test No recommended tests at this time.
+   */
+  ~ZoomArgument() override = default;
+  /**
+   * @brief Sets the cells per dot of the viewport.
+   * @details Changes the appValue viewport.zoom to the input value, at least
+   * 1. If no value, or an invalid value, is passed, the simulation will not
+   * run.
+   * @param appValues struct holding application Values
+   * @param zoom holding the cells per dot.
+   * @test Pass default ApplicationValues object and a given value, test that
+   * the function sets viewport.zoom to the given value.
+   * @test Test that the bool runSimulation is set to false if argument is
+   * passed with no value.
+   */
+  void execute(ApplicationValues& appValues, char* zoom) override;
+};
+
+/**
+ * @brief This class handles the synchronized output argument if passed by
+ * the user.
+ * @details Derived class from BaseArgument. Is responsible for
+ * showing the frames on the alternate screen with synchronized
+ * updates, "on" or "off".
+ * @test Test the constructor when given the -so argument.
+ * @test Test the Execute function.
+ */
+class SynchronizedOutputArgument : public BaseArgument {
+ public:
+  /**
+   * @brief Default constructor for the derived SynchronizedOutputArgument class
+   * @details BaseArgument constructor is used to set inherited argValue.
+   * @test That an object can be created and that the getValue() function
+   * returns the correct argValue.
+   */
+  SynchronizedOutputArgument() : BaseArgument("-so") {}
+  /**
+   * @brief Overriden destructor for SynchronizedOutputArgument class.
+   * @details Overriden default destructor for a derived class.
+   * @test No recommended tests at this time.
+   */
+  ~SynchronizedOutputArgument() override = default;
+  /**
+   * @brief Sets if the frames are shown with synchronized updates.
+   * @details Sets the appValue synchronizedOutput if the value is "on". If
+   * no value, or an unknown value, is passed, the simulation will not run.
+   * @param appValues struct holding application Values
+   * @param synchronized holding "on" or "off".
+   * @test Pass default ApplicationValues object and a given value, test that
+   * the function sets synchronizedOutput to the correct value.
+   * @test Test that the bool runSimulation is set to false if argument is
+   * passed with no value.
+   */
+  void execute(ApplicationValues& appValues, char* synchronized) override;
+};
+
+/**
+ * @brief This class handles the export directory argument if passed by the user.
+ * @details Derived class from BaseArgument. Is responsible for
+ * the directory the generations are exported to as images.
+ * @test Test the constructor when given the -ex argument.
+ * @test Test the Execute function.
+ */
+class ExportDirectoryArgument : public BaseArgument {
+ public:
+  /**
+   * @brief Default constructor for the derived ExportDirectoryArgument class
+   * @details BaseArgument constructor is used to set inherited argValue.
+   * @test That an object can be created and that the getValue() function
+   * returns the correct argValue.
+   */
+  ExportDirectoryArgument() : BaseArgument("-ex") {}
+  /**
+   * @brief Overriden destructor for ExportDirectoryArgument class.
+   * @details Overriden default destructor for a derived class.
+   * @test No recommended tests at this time.
+   */
+  ~ExportDirectoryArgument() override = default;
+  /**
+   * @brief Sets the directory the images are written to.
+   * @details Changes the appValue exportDirectory to the input value. If no
+   * value is passed, the simulation will not run.
+   * @param appValues struct holding application Values
+   * @param directory holding the name of an existing directory.
+   * @test Pass default ApplicationValues object and a given value, test that
+   * the function sets exportDirectory to the given value.
+   * @test Test that the bool runSimulation is set to false if argument is
+   * passed with no value.
+   */
+  void execute(ApplicationValues& appValues, char* directory) override;
+};
+
+/**
+ * @brief This class handles the export interval argument if passed by the user.
+ * @details Derived class from BaseArgument. Is responsible for
+ * the generations between two exported images.
+ * @test Test the constructor when given the -ee argument.
+ * @test Test the Execute function.
+ */
+class ExportEveryArgument : public BaseArgument {
+ public:
+  /**
+   * @brief Default constructor for the derived ExportEveryArgument class
+   * @details BaseArgument constructor is used to set inherited argValue.
+   * @test That an object can be created and that the getValue() function
+   * returns the correct argValue.
+   */
+  ExportEveryArgument() : BaseArgument("-ee") {}
+  /**
+   * @brief Overriden destructor for ExportEveryArgument class.
+   * @details Overriden default destructor for a derived class.
+   * @test No recommended tests at this time.
+   */
+  ~ExportEveryArgument() override = default;
+  /**
+   * @brief Sets the generations between two exported images.
+   * @details Changes the appValue exportEvery to the input value, at least 1.
+   * If no value, or an invalid value, is passed, the simulation will not
+   * run.
+   * @param appValues struct holding application Values
+   * @param every holding the generations between two images.
+   * @test Pass default ApplicationValues object and a given value, test that
+   * the function sets exportEvery to the given value.
+   * @test Test that the bool runSimulation is set to false if argument is
+   * passed with no value.
+   */
+  void execute(ApplicationValues& appValues, char* every) override;
+};
+
+/**
+ * @brief This class handles the export format argument if passed by the user.
+ * @details Derived class from BaseArgument. Is responsible for
+ * the format of the exported images, "ppm" or "png".
+ * @test Test the constructor when given the -ef argument.
+ * @test Test the Execute function.
+ */
+class ExportFormatArgument : public BaseArgument {
+ public:
+  /**
+   * @brief Default constructor for the derived ExportFormatArgument class
+   * @details BaseArgument constructor is used to set inherited argValue.
+   * @test That an object can be created and that the getValue() function
+   * returns the correct argValue.
+   */
+  ExportFormatArgument() : BaseArgument("-ef") {}
+  /**
+   * @brief Overriden destructor for ExportFormatArgument class.
+   * @details Overriden default destructor for a derived class.
+   * @test No recommended tests at this time.
+   */
+  ~ExportFormatArgument() override = default;
+  /**
+   * @brief Sets the format of the exported images.
+   * @details Changes the appValue exportFormat to the given format. If no
+   * value, or an unknown value, is passed, the simulation will not run.
+   * @param appValues struct holding application Values
+   * @param format holding "ppm" or "png".
+   * @test Pass default ApplicationValues object and a given value, test that
+   * the function sets exportFormat to the given value.
+   * @test Test that the bool runSimulation is set to false if argument is
+   * passed with no value.
+   */
+  void execute(ApplicationValues& appValues, char* format) override;
+};
+
+/**
+ * @brief This class handles the stream argument if passed by the user.
+ * @details Derived class from BaseArgument. Is responsible for
+ * the file or named pipe the frames are streamed to.
+ * @test Test the constructor when given the -st argument.
+ * @test Test the Execute function.
+ */
+class StreamArgument : public BaseArgument {
+ public:
+  /**
+   * @brief Default constructor for the derived StreamArgument class
+   * @details BaseArgument constructor is used to set inherited argValue.
+   * @test That an object can be created and that the getValue() function
+   * returns the correct argValue.
+   */
+  StreamArgument() : BaseArgument("-st") {}
+  /**
+   * @brief Overriden destructor for StreamArgument class.
+   * @details Overriden default destructor for a derived class.
+   * @test No recommended tests at this time.
+   */
+  ~StreamArgument() override = default;
+  /**
+   * @brief Sets where the frames are streamed.
+   * @details Changes the appValue streamPath to the input value. If no value
+   * is passed, the simulation will not run.
+   * @param appValues struct holding application Values
+   * @param path holding a file name, or "-" for the standard output.
+   * @test Pass default ApplicationValues object and a given value, test that
+   * the function sets streamPath to the given value.
+   * @test Test that the bool runSimulation is set to false if argument is
+   * passed with no value.
+   */
+  void execute(ApplicationValues& appValues, char* path) override;
+};
+
+/**
+ * @brief This class handles the stream format argument if passed by the user.
+ * @details Derived class from BaseArgument. Is responsible for
+ * the pixel format of the streamed frames, "rgb" or "palette".
+ * @test Test the constructor when given the -sf argument.
+ * @test Test the Execute function.
+ */
+class StreamFormatArgument : public BaseArgument {
+ public:
+  /**
+   * @brief Default constructor for the derived StreamFormatArgument class
+   * @details BaseArgument constructor is used to set inherited argValue.
+   * @test That an object can be created and that the getValue() function
+   * returns the correct argValue.
+   */
+  StreamFormatArgument() : BaseArgument("-sf") {}
+  /**
+   * @brief Overriden destructor for StreamFormatArgument class.
+   * @details Overriden default destructor for a derived class.
+   * @test No recommended tests at this time.
+   */
+  ~StreamFormatArgument() override = default;
+  /**
+   * @brief Sets the pixel format of the streamed frames.
+   * @details Changes the appValue streamFormat to the given format. If no
+   * value, or an unknown value, is passed, the simulation will not run.
+   * @param appValues struct holding application Values
+   * @param format holding "rgb" or "palette".
+   * @test Pass default ApplicationValues object and a given value, test that
+   * the function sets streamFormat to the given value.
+   * @test Test that the bool runSimulation is set to false if argument is
+   * passed with no value.
+   */
+  void execute(ApplicationValues& appValues, char* format) override;
+};
+
 #endif  // GAMEOFLIFE_MAINARGUMENTS_H
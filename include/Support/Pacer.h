@@ -0,0 +1,65 @@
+/**
+ * @file    Pacer.h
+ * @author      Group 11
+ * @date        October 2026
+ * @version     0.3
+ *
+ * @brief This file contains the pacing of a loop to a target rate.
+*/
+
+#ifndef GAMEOFLIFE_PACER_H
+#define GAMEOFLIFE_PACER_H
+
+#include <chrono>
+
+using namespace std;
+
+/**
+ * @brief Data structure holding the rates a simulation achieved.
+ */
+struct PacingStats {
+  double framesPerSecond;       ///< frames printed per second
+  double generationsPerSecond;  ///< generations calculated per second
+};
+
+/**
+ * @brief Paces a loop to a target number of ticks per second.
+ *
+ * @details Every tick has a deadline, one interval after the deadline of the
+ * previous tick, and wait() sleeps until it with sleep_until. The time spent
+ * between the waits is part of the interval, so the rate does not drift with
+ * the work done in the loop. A loop that falls more than one interval behind
+ * drops the missed deadlines instead of hurrying to catch up. A rate of 0 or
+ * less does not pace the loop, only counts the ticks.
+ */
+class Pacer {
+ private:
+  chrono::steady_clock::duration interval;  ///< time between two ticks
+  chrono::steady_clock::time_point start;     ///< when the pacer was created
+  chrono::steady_clock::time_point deadline;  ///< deadline of the next tick
+  chrono::steady_clock::time_point lastTick;  ///< when the last tick was counted
+  unsigned long ticks;                        ///< ticks counted
+
+ public:
+  /**
+   * @brief Constructor, the first deadline is one interval from now
+   * @param ticksPerSecond target rate, 0 or less for no pacing
+   */
+  explicit Pacer(double ticksPerSecond);
+
+  /**
+   * @brief Counts ticks and sleeps until their deadline
+   * @test That the achieved rate follows the target rate
+   * @test That an unpaced pacer does not sleep
+   * @param count ticks done since the last wait
+   */
+  void wait(int count = 1);
+
+  /**
+   * @brief Get the ticks per second, from the creation to the last tick
+   * @return double achieved rate, 0 before the first tick
+   */
+  double getAchievedRate() const;
+};
+
+#endif //GAMEOFLIFE_PACER_H
@@ -15,6 +15,9 @@
 #ifndef GAMEOFLIFE_SUPPORTSTRUCTURES_H
 #define GAMEOFLIFE_SUPPORTSTRUCTURES_H
 
+#include <ctime>
+#include <string>
+
 /**
  * @brief Constitues a single Point in the simulated world.
  *
@@ -47,4 +50,73 @@ struct Dimensions {
       HEIGHT;  ///< representing a height of the game world.
 };
 
+/**
+ * @brief A rectangular part of the simulated world.
+ * @details Both corners are inclusive and given in world coordinates, where
+ * the rim cells are at column/row 0 and WIDTH + 1/HEIGHT + 1. Regions are
+ * used to execute rules on a part of the world at a time.
+ */
+struct Region {
+  Point topLeft,  ///< upper left corner of the region, inclusive
+      bottomRight;  ///< lower right corner of the region, inclusive
+
+  /**
+   * @brief Checks if a point is inside the region.
+   * @param point the point to check
+   * @return bool true if the point is inside the region
+   */
+  bool contains(const Point& point) const {
+    return point.x >= topLeft.x && point.x <= bottomRight.x &&
+           point.y >= topLeft.y && point.y <= bottomRight.y;
+  }
+};
+
+/**
+ * @brief Data structure holding how a random world is filled.
+ * @details Default constructed, the seed is taken from the clock and half of
+ * the cells are alive, as they always were.
+ */
+struct RandomFill {
+  unsigned int seed;   ///< seed the random streams are derived from
+  double liveDensity;  ///< share of the cells that are alive, 0 to 1
+
+  /// @brief Seed from the clock, half of the cells alive
+  RandomFill()
+      : seed(static_cast<unsigned int>(time(nullptr))), liveDensity(0.5) {}
+
+  /**
+   * @brief A given seed and density
+   * @param seed seed the random streams are derived from
+   * @param liveDensity share of the cells that are alive, 0 to 1
+   */
+  RandomFill(unsigned int seed, double liveDensity)
+      : seed(seed), liveDensity(liveDensity) {}
+};
+
+/**
+ * @brief Data structure holding how the world of a population is created.
+ * @details Each population has its own settings, so several populations
+ * with different worlds can be simulated at the same time.
+ */
+struct WorldSettings {
+  Dimensions dimensions;  ///< width and height, replaced by those of the file
+  std::string fileName;   ///< file to read the world from, empty for random
+  RandomFill randomFill;  ///< how a random world is filled
+
+  /// @brief A random world of 80x24 cells
+  WorldSettings() : dimensions({80, 24}) {}
+};
+
+/**
+ * @brief Data structure holding the outcome of a simulation without
+ * presentation.
+ */
+struct HeadlessStats {
+  int generations;              ///< generations calculated
+  double seconds;               ///< time spent calculating them
+  unsigned long long cellUpdates;  ///< cells calculated, rim excluded
+  unsigned long long checksum;  ///< checksum of the alive cells at the end
+  int population;               ///< alive cells at the end
+};
+
 #endif  // GAMEOFLIFE_SUPPORTSTRUCTURES_H
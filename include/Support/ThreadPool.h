@@ -0,0 +1,107 @@
+/**
+ * @file    ThreadPool.h
+ * @author      Group 11
+ * @date        October 2026
+ * @version     0.3
+ *
+ * @brief This file contains a pool of threads kept alive for the whole
+ * simulation.
+*/
+
+#ifndef GAMEOFLIFE_THREADPOOL_H
+#define GAMEOFLIFE_THREADPOOL_H
+
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using namespace std;
+
+/**
+ * @brief Runs a task on a fixed number of threads, one call per worker.
+ *
+ * @details The threads are created once and wait between the tasks, so each
+ * phase of a generation does not pay for starting threads. The calling thread
+ * is worker 0 and run() returns when every worker is done, which makes each
+ * call a barrier between two phases.
+ */
+class ThreadPool {
+ private:
+  vector<thread> workers;        ///< threads of worker 1 and up
+  mutex poolMutex;               ///< guards the members below
+  condition_variable startTask;  ///< signalled when a task is started
+  condition_variable taskDone;   ///< signalled when a worker is done
+  function<void(int)> task;      ///< the task of the current round
+  unsigned long round;           ///< number of started rounds
+  int running;                   ///< workers still running the current round
+  bool stopping;                 ///< set when the pool is destroyed
+  exception_ptr failure;         ///< first exception thrown by a worker
+  vector<int> affinity;          ///< CPU of each worker, -1 if not pinned
+  vector<char> pinPending;       ///< if a worker has not applied its CPU yet
+  thread::id pinnedCaller;       ///< thread pinned as worker 0
+
+  /**
+   * @brief Takes the CPU a worker has not pinned itself to yet, called with
+   * poolMutex locked
+   * @param worker index of the worker
+   * @return int the CPU, -1 if nothing is pending
+   */
+  int takePendingCpu(int worker);
+
+  /**
+   * @brief Waits for tasks and runs them, until the pool is destroyed
+   * @param worker index of the worker
+   */
+  void workerLoop(int worker);
+
+ public:
+  /**
+   * @brief Constructor, starts the threads
+   * @test That the task is called once for every worker
+   * @param threadCount number of workers, the calling thread included
+   */
+  explicit ThreadPool(int threadCount);
+
+  /**
+   * @brief Destructor, stops and joins the threads
+   */
+  ~ThreadPool();
+
+  /**
+   * @brief Get the number of workers, the calling thread included
+   * @return int number of workers
+   */
+  int getThreadCount() const { return static_cast<int>(workers.size()) + 1; }
+
+  /**
+   * @brief Calls the task once for every worker and waits for all of them
+   * @details An exception thrown by a worker is thrown again by run(), after
+   * all workers are done.
+   * @test That an exception in a worker is thrown by run
+   * @param task called with the index of the worker, from 0
+   */
+  void run(const function<void(int)> &task);
+
+  /**
+   * @brief Pins each worker to a CPU
+   * @details The workers pins themselves when the next task is started.
+   * Worker 0 is pinned on the thread that calls run(), again if another
+   * thread calls it later. Pinning is only done
+   * on Linux, elsewhere the workers are left to the operating system.
+   * @test That the task still runs on every worker
+   * @param cpus CPU of each worker, from worker 0
+   */
+  void pinWorkers(const vector<int> &cpus);
+
+  /**
+   * @brief Pins the calling thread to a CPU
+   * @param cpu the CPU
+   * @return bool true if the thread was pinned
+   */
+  static bool pinCurrentThread(int cpu);
+};
+
+#endif //GAMEOFLIFE_THREADPOOL_H
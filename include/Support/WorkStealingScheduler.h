@@ -0,0 +1,110 @@
+/**
+ * @file    WorkStealingScheduler.h
+ * @author      Group 11
+ * @date        October 2026
+ * @version     0.3
+ *
+ * @brief This file contains a scheduler balancing tasks between the workers
+ * of a ThreadPool by work stealing.
+*/
+
+#ifndef GAMEOFLIFE_WORKSTEALINGSCHEDULER_H
+#define GAMEOFLIFE_WORKSTEALINGSCHEDULER_H
+
+#include <chrono>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <vector>
+#include "ThreadPool.h"
+
+using namespace std;
+
+/**
+ * @brief Data structure holding what a worker did, used for tuning.
+ */
+struct WorkerStats {
+  unsigned long tasks;   ///< tasks run by the worker
+  unsigned long steals;  ///< tasks taken from other workers
+  double idleSeconds;    ///< time spent waiting for the other workers
+};
+
+/**
+ * @brief Runs tasks on the workers of a pool, where workers that runs out
+ * of tasks steals from the others.
+ *
+ * @details Every worker has its own queue of tasks. The tasks are handed out
+ * in contiguous chunks, so neighbouring tasks stays on the same worker. A
+ * worker takes its tasks from the back of its queue, and when it is empty
+ * steals from the front of the queues of the other workers, first from the
+ * workers on its own NUMA node if the nodes are known. A worker is idle
+ * from when no queue has any tasks left until the last worker is done.
+ */
+class WorkStealingScheduler {
+ private:
+  /// @brief Queue of tasks of one worker
+  struct WorkerQueue {
+    mutex queueMutex;    ///< guards tasks
+    deque<size_t> tasks; ///< tasks not yet run
+  };
+
+  ThreadPool &pool;              ///< the pool running the workers
+  vector<WorkerQueue> queues;    ///< one queue for each worker
+  vector<WorkerStats> stats;     ///< one entry for each worker
+  vector<vector<int>> victims;   ///< workers to steal from, in order
+
+  /**
+   * @brief Takes the next task of a worker, stealing if needed
+   * @param worker index of the worker
+   * @param task set to the task
+   * @return bool false when there are no tasks left in any queue
+   */
+  bool nextTask(int worker, size_t &task);
+
+ public:
+  /**
+   * @brief Constructor
+   * @param pool the pool running the tasks, must outlive the scheduler
+   */
+  explicit WorkStealingScheduler(ThreadPool &pool);
+
+  /**
+   * @brief Runs every task once and waits for all of them
+   * @test That every task is run exactly once
+   * @test That the tasks and steals are counted
+   * @param tasks the tasks to run, handed to the work function
+   * @param work called once for every task, by any worker
+   */
+  void run(const vector<size_t> &tasks, const function<void(size_t)> &work);
+
+  /**
+   * @brief Runs every task once and waits for all of them
+   * @param tasks the tasks to run, handed to the work function
+   * @param work called once for every task with the index of the worker
+   * running it
+   */
+  void run(const vector<size_t> &tasks,
+           const function<void(int, size_t)> &work);
+
+  /**
+   * @brief Sets the NUMA node of each worker
+   * @details Workers steal from the workers on their own node before the
+   * workers on other nodes.
+   * @test That a worker steals from its own node first
+   * @param nodes node of each worker, from worker 0
+   */
+  void setWorkerNodes(const vector<int> &nodes);
+
+  /**
+   * @brief Get what each worker has done since the last reset
+   * @return vector of WorkerStats, one for each worker
+   */
+  const vector<WorkerStats> &getStats() const { return stats; }
+
+  /**
+   * @brief Sets all worker stats to zero
+   */
+  void resetStats();
+};
+
+#endif //GAMEOFLIFE_WORKSTEALINGSCHEDULER_H
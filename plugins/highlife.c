@@ -0,0 +1,54 @@
+/*
+ * Filename    highlife.c
+ * Author      Group 11
+ * Date        October 2026
+ * Version     0.3
+ *
+ * Sample rule plugin implementing HighLife (B36/S23). A cell is born with 3
+ * or 6 alive neighbours and survives with 2 or 3.
+ *
+ * The inner loop has no branches and only reads neighbouring bytes, so the
+ * compiler can vectorise it. Build as a shared library and load the directory
+ * containing it with the -pd argument, then select it with "-er highlife".
+*/
+
+#include "GoL_Rules/RulePlugin.h"
+
+/* Bit n is set if a cell with n alive neighbours is born or survives. */
+#define BORN_MASK     ((1u << 3) | (1u << 6))
+#define SURVIVE_MASK  ((1u << 2) | (1u << 3))
+
+static void highlifeStep(const unsigned char *in, int inStride,
+                         unsigned char *out, int outStride,
+                         int width, int height) {
+    int row, column;
+    for (row = 0; row < height; row++) {
+        const unsigned char *above = in + row * inStride;
+        const unsigned char *middle = above + inStride;
+        const unsigned char *below = middle + inStride;
+        unsigned char *result = out + row * outStride;
+
+        for (column = 0; column < width; column++) {
+            unsigned int neighbours =
+                above[column] + above[column + 1] + above[column + 2] +
+                middle[column] + middle[column + 2] +
+                below[column] + below[column + 1] + below[column + 2];
+            unsigned int alive = middle[column + 1];
+            unsigned int mask = alive ? SURVIVE_MASK : BORN_MASK;
+            result[column] = (unsigned char) ((mask >> neighbours) & 1u);
+        }
+    }
+}
+
+static const GoLRulePlugin HIGHLIFE = {
+    GOL_RULE_PLUGIN_ABI_VERSION,
+    "highlife",
+    highlifeStep
+};
+
+#if defined(__GNUC__)
+__attribute__((visibility("default")))
+#endif
+const GoLRulePlugin *gol_rule_plugin(void) {
+    return &HIGHLIFE;
+}
@@ -0,0 +1,120 @@
+/*
+ * Filename    Autotuner.cpp
+ * Author      Group 11
+ * Date        October 2026
+ * Version     0.3
+*/
+
+#include "Autotuner.h"
+#include <chrono>
+#include <fstream>
+#include <sstream>
+#include <thread>
+#include "Support/CpuTopology.h"
+#include "Support/FileLoader.h"
+
+// Try powers of two up to the CPUs of the machine, with a few tile sizes.
+Autotuner::Autotuner(const WorldSettings& world, const string& evenRuleName, const string& oddRuleName,
+                     const string& ruleMapFileName, const string& cacheFileName)
+        : world(world), evenRuleName(evenRuleName), oddRuleName(oddRuleName),
+          ruleMapFileName(ruleMapFileName), cacheFileName(cacheFileName),
+          tileCandidates({8, 16, 32, 64}), calibrated(false) {
+
+    int cpus = static_cast<int>(thread::hardware_concurrency());
+    for (int threads = 1; threads < cpus; threads *= 2)
+        threadCandidates.push_back(threads);
+    threadCandidates.push_back(cpus > 1 ? cpus : 1);
+}
+
+void Autotuner::setCandidates(const vector<int>& threads, const vector<int>& tileSizes) {
+    threadCandidates = threads;
+    tileCandidates = tileSizes;
+}
+
+// Rules, world size and CPU model, the size of a file world is read from the file.
+string Autotuner::getCacheKey() {
+    Dimensions dimensions = world.dimensions;
+    if (!world.fileName.empty()) {
+        map<Point, Cell> cells;
+        FileLoader().loadPopulationFromFile(cells, world.fileName, dimensions);
+    }
+
+    string rules = evenRuleName + "/" + (oddRuleName.empty() ? evenRuleName : oddRuleName);
+    if (!ruleMapFileName.empty())
+        rules += "+" + ruleMapFileName;
+    return rules + "\t" + to_string(dimensions.WIDTH) + "x" + to_string(dimensions.HEIGHT)
+           + "\t" + CpuTopology::readCpuModel();
+}
+
+// Lines are the key followed by the thread count and tile size, separated by tabs.
+bool Autotuner::readCache(const string& key, TuningChoice& choice) {
+    ifstream file(cacheFileName);
+    string line;
+    while (getline(file, line)) {
+        size_t split = line.rfind('\t');
+        split = (split == string::npos || split == 0) ? string::npos : line.rfind('\t', split - 1);
+        if (split == string::npos || line.substr(0, split) != key)
+            continue;
+
+        istringstream values(line.substr(split + 1));
+        if (values >> choice.threads >> choice.tileSize)
+            return true;
+    }
+    return false;
+}
+
+// Rewrite the cache with the other keys kept, and the choice last.
+void Autotuner::writeCache(const string& key, const TuningChoice& choice) {
+    vector<string> lines;
+    ifstream in(cacheFileName);
+    string line;
+    while (getline(in, line)) {
+        if (line.compare(0, key.size() + 1, key + "\t") != 0)
+            lines.push_back(line);
+    }
+    in.close();
+
+    ofstream out(cacheFileName, ios::trunc);
+    for (auto & kept : lines)
+        out << kept << "\n";
+    out << key << "\t" << choice.threads << "\t" << choice.tileSize << "\n";
+}
+
+// Build the population like the simulation would, warm up one generation, and time the rest.
+double Autotuner::timeCandidate(const TuningChoice& candidate) {
+    Population population;
+    population.setWorld(world);
+    population.setTileSize(candidate.tileSize);
+    population.setThreadCount(candidate.threads);
+    population.initiatePopulation(evenRuleName, oddRuleName, ruleMapFileName);
+    population.calculateNewGeneration();
+
+    auto start = chrono::steady_clock::now();
+    for (int generation = 0; generation < AUTOTUNE_GENERATIONS; generation++)
+        population.calculateNewGeneration();
+    return chrono::duration<double>(chrono::steady_clock::now() - start).count();
+}
+
+// Use the cache if it knows the key, otherwise time every candidate and cache the fastest.
+TuningChoice Autotuner::tune() {
+    string key = getCacheKey();
+    TuningChoice choice{1, DEFAULT_TILE_SIZE};
+    calibrated = !readCache(key, choice);
+    if (!calibrated)
+        return choice;
+
+    double fastest = -1.0;
+    for (int threads : threadCandidates) {
+        for (int tileSize : tileCandidates) {
+            TuningChoice candidate{threads, tileSize};
+            double seconds = timeCandidate(candidate);
+            if (fastest < 0.0 || seconds < fastest) {
+                fastest = seconds;
+                choice = candidate;
+            }
+        }
+    }
+
+    writeCache(key, choice);
+    return choice;
+}
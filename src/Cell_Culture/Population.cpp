@@ -7,16 +7,18 @@
 
 #include "Cell_Culture/Population.h"
 #include "GoL_Rules/RuleFactory.h"
+#include <algorithm>
+#include <chrono>
 #include <random>
 #include <ctime>
 #include <string>
 #include "Support/FileLoader.h"
-#include "Support/Globals.h"
 
 // Initializing cell culture and the concrete rules to be used in simulation.
-void Population::initiatePopulation(const string& evenRuleName, string oddRuleName) {
+void Population::initiatePopulation(const string& evenRuleName, string oddRuleName,
+                                    const string& ruleMapFileName) {
     // Determine whether the cell culture should be randomized or built from file.
-    if (!fileName.empty())
+    if (!world.fileName.empty())
         buildCellCultureFromFile();
     else
         randomizeCellCulture();
@@ -26,39 +28,347 @@ void Population::initiatePopulation(const string& evenRuleName, string oddRuleNa
         oddRuleName = evenRuleName;
     this->evenRuleOfExistence = RuleFactory::getInstance().createAndReturnRule(cells, evenRuleName);
     this->oddRuleOfExistence = RuleFactory::getInstance().createAndReturnRule(cells, oddRuleName);
+
+    // assign rules to the tiles of the world
+    RuleMap ruleMap;
+    if (!ruleMapFileName.empty())
+        ruleMap.loadFromFile(ruleMapFileName);
+    buildRuleTiles(ruleMap);
+    buildTwoStepKernels();
+}
+
+// Split the world into tiles and pick the rules for each tile from the rule map.
+void Population::buildRuleTiles(const RuleMap& ruleMap) {
+    ruleTiles.clear();
+    evenRules.clear();
+    oddRules.clear();
+    if (cells.empty())
+        return;
+
+    // the halo rows around a slab are read by the rules, but are not tiles of their own
+    Region world{cells.begin()->first, cells.rbegin()->first};
+    if (slabLastRow >= 0) {
+        world.topLeft.y = max(world.topLeft.y, slabFirstRow);
+        world.bottomRight.y = min(world.bottomRight.y, slabLastRow);
+    }
+    for (auto & area : ruleMap.partition(world, tileSize)) {
+        ruleTiles.push_back(RuleTile{area.region,
+                                     getMappedRule(area.evenRuleName, evenRuleOfExistence),
+                                     getMappedRule(area.oddRuleName, oddRuleOfExistence)});
+
+        // remember each rule once, to begin and end its generations
+        RuleTile& tile = ruleTiles.back();
+        if (find(evenRules.begin(), evenRules.end(), tile.evenRule) == evenRules.end())
+            evenRules.push_back(tile.evenRule);
+        if (find(oddRules.begin(), oddRules.end(), tile.oddRule) == oddRules.end())
+            oddRules.push_back(tile.oddRule);
+    }
+    buildBands();
+    buildTileCells();
+}
+
+// Sets the number of threads and creates the pool used by them.
+void Population::setThreadCount(int count) {
+    threadCount = (count > 1) ? count : 1;
+
+    // the scheduler uses the pool, so it is replaced as well
+    delete scheduler;
+    delete threadPool;
+    threadPool = (threadCount > 1) ? new ThreadPool(threadCount) : nullptr;
+    scheduler = (threadPool != nullptr && workStealing) ? new WorkStealingScheduler(*threadPool) : nullptr;
+    buildBands();
+    placeWorkers();
+}
+
+// Sets if work stealing is used, the scheduler needs the thread pool.
+void Population::setWorkStealing(bool enabled) {
+    workStealing = enabled;
+
+    delete scheduler;
+    scheduler = (threadPool != nullptr && workStealing) ? new WorkStealingScheduler(*threadPool) : nullptr;
+    placeWorkers();
+}
+
+// Sets if the threads are pinned to the CPUs of the NUMA nodes.
+void Population::setThreadPinning(bool enabled) {
+    threadPinning = enabled;
+    placeWorkers();
+}
+
+// Pin the workers node by node, the cells are moved to them before the next generation.
+void Population::placeWorkers() {
+    placements.clear();
+    workerBytes.assign(threadCount, 0);
+    workerSeconds.assign(threadCount, 0.0);
+    if (!threadPinning || threadPool == nullptr)
+        return;
+
+    placements = CpuTopology().placeWorkers(threadCount);
+    vector<int> cpus, nodes;
+    for (auto & placement : placements) {
+        cpus.push_back(placement.cpu);
+        nodes.push_back(placement.node);
+    }
+    threadPool->pinWorkers(cpus);
+    if (scheduler != nullptr)
+        scheduler->setWorkerNodes(nodes);
+
+    // done by the thread calculating the generations, so it is the one pinned as worker 0
+    cellsPlacementPending = true;
+}
+
+// Copy the cells of each band into a new map on the worker owning the band.
+void Population::placeCellsOnWorkers() {
+    vector<map<Point, Cell>> bandCells(bandStarts.size() - 1);
+
+    threadPool->run([&](int band) {
+        map<Point, Cell>& placed = bandCells[band];
+        for (size_t tile = bandStarts[band]; tile < bandStarts[band + 1]; tile++) {
+            const Region& region = ruleTiles[tile].region;
+            for (int column = region.topLeft.x; column <= region.bottomRight.x; column++) {
+                auto first = cells.lower_bound(Point{column, region.topLeft.y});
+                auto last = cells.upper_bound(Point{column, region.bottomRight.y});
+
+                // the node is allocated and the cell first written by this worker
+                for (auto it = first; it != last; ++it)
+                    placed.insert(placed.end(), *it);
+            }
+        }
+    });
+
+    // the nodes are spliced, not copied, so they stay where their worker wrote them
+    map<Point, Cell> placedCells;
+    for (auto & placed : bandCells)
+        placedCells.merge(placed);
+
+    // the rules keeps a reference to the map, so its content is swapped
+    cells.swap(placedCells);
+    buildTileCells();
+}
+
+// Sum what the workers of each node have gone through.
+vector<NodeStats> Population::getNodeStats() {
+    vector<NodeStats> stats;
+    for (size_t worker = 0; worker < placements.size(); worker++) {
+        int node = placements[worker].node;
+        auto it = find_if(stats.begin(), stats.end(), [node](const NodeStats& nodeStats) {
+            return nodeStats.node == node;
+        });
+        if (it == stats.end())
+            it = stats.insert(stats.end(), NodeStats{node, 0, 0, 0.0});
+
+        it->threads++;
+        it->bytes += workerBytes[worker];
+        it->busySeconds += workerSeconds[worker];
+    }
+    return stats;
+}
+
+// Estimate the bytes of the cells a worker has gone through from their number, and measure the time it took.
+void Population::countTraffic(int worker, size_t firstTile, size_t lastTile,
+                              const chrono::steady_clock::time_point& start) {
+    for (size_t tile = firstTile; tile < lastTile; tile++)
+        workerBytes[worker] += tileCells[tile].size() * sizeof(Cell);
+    workerSeconds[worker] += chrono::duration<double>(chrono::steady_clock::now() - start).count();
+}
+
+// Returns the stats of the work stealing workers.
+vector<WorkerStats> Population::getWorkerStats() {
+    if (scheduler == nullptr)
+        return vector<WorkerStats>();
+    return scheduler->getStats();
+}
+
+// Remember the cells of each tile, the map is not changed while simulating.
+void Population::buildTileCells() {
+    tileCells.assign(ruleTiles.size(), vector<Cell*>());
+    tileAlive.assign(ruleTiles.size(), 0);
+    allTiles.clear();
+
+    tileColumns = 0;
+    for (size_t tile = 0; tile < ruleTiles.size(); tile++) {
+        allTiles.push_back(tile);
+
+        // the tiles form a grid, count the tiles of the first row
+        if (ruleTiles[tile].region.topLeft.y == ruleTiles.front().region.topLeft.y)
+            tileColumns++;
+    }
+
+    // the cell pointers of a band are first written by the worker using them
+    auto fillBand = [this](int band) {
+        for (size_t tile = bandStarts[band]; tile < bandStarts[band + 1]; tile++) {
+            const Region& region = ruleTiles[tile].region;
+            for (int column = region.topLeft.x; column <= region.bottomRight.x; column++) {
+                auto it = cells.lower_bound(Point{column, region.topLeft.y});
+                for (; it != cells.end() && it->first.x == column
+                       && it->first.y <= region.bottomRight.y; ++it)
+                    tileCells[tile].push_back(&it->second);
+            }
+        }
+    };
+    if (threadPool != nullptr && bandStarts.size() == static_cast<size_t>(threadCount) + 1)
+        threadPool->run(fillBand);
+    else {
+        for (size_t band = 0; band + 1 < bandStarts.size(); band++)
+            fillBand(static_cast<int>(band));
+    }
+}
+
+// Tiles that may change, a tile or a tile next to it has alive cells.
+vector<size_t> Population::findActiveTiles(const vector<RuleOfExistence*>& rules) {
+    for (auto & rule : rules) {
+        if (!rule->emptyStaysEmpty())
+            return allTiles;
+    }
+
+    // the cells around a tile are all in the tiles next to it
+    vector<size_t> activeTiles;
+    size_t tileRows = ruleTiles.size() / tileColumns;
+    for (size_t tile = 0; tile < ruleTiles.size(); tile++) {
+        size_t row = tile / tileColumns;
+        size_t column = tile % tileColumns;
+
+        bool active = false;
+        for (size_t r = (row > 0 ? row - 1 : 0); r <= row + 1 && r < tileRows && !active; r++) {
+            for (size_t c = (column > 0 ? column - 1 : 0); c <= column + 1 && c < tileColumns; c++) {
+                if (tileAlive[r * tileColumns + c]) {
+                    active = true;
+                    break;
+                }
+            }
+        }
+        if (active)
+            activeTiles.push_back(tile);
+    }
+    return activeTiles;
+}
+
+// Split the tiles into one band of whole tile rows for each thread.
+void Population::buildBands() {
+    bandStarts.clear();
+    if (ruleTiles.empty())
+        return;
+
+    // the tiles are ordered row by row, find the first tile of each row
+    vector<size_t> rowStarts;
+    for (size_t tile = 0; tile < ruleTiles.size(); tile++) {
+        if (tile == 0 || ruleTiles[tile].region.topLeft.y != ruleTiles[tile - 1].region.topLeft.y)
+            rowStarts.push_back(tile);
+    }
+
+    size_t rows = rowStarts.size();
+    for (int band = 0; band < threadCount; band++) {
+        size_t firstRow = rows * band / threadCount;
+        bandStarts.push_back(firstRow < rows ? rowStarts[firstRow] : ruleTiles.size());
+    }
+    bandStarts.push_back(ruleTiles.size());
+}
+
+// Compose the even and odd rule into kernels, if the whole world uses them and they have step tables.
+void Population::buildTwoStepKernels() {
+    hasTwoStepKernels = false;
+    if (evenRules.size() != 1 || oddRules.size() != 1)
+        return;
+
+    vector<unsigned char> evenTable, oddTable;
+    if (!evenRules.front()->getStepTable(evenTable) || !oddRules.front()->getStepTable(oddTable))
+        return;
+
+    evenKernel = TwoStepKernel(evenTable, oddTable);
+    oddKernel = TwoStepKernel(oddTable, evenTable);
+    hasTwoStepKernels = true;
+}
+
+// Sets the generations asked for per sweep.
+void Population::setGenerationsPerSweep(int generations) {
+    generationsPerSweep = (generations == 2) ? 2 : 1;
+}
+
+// Returns the rule for a rule map name, each name is only created once.
+RuleOfExistence* Population::getMappedRule(const string& ruleName, RuleOfExistence* defaultRule) {
+    // areas without a rule, or with the same rule as the default, shares the default rule
+    if (ruleName.empty() || ruleName == defaultRule->getRuleName())
+        return defaultRule;
+
+    auto it = mappedRules.find(ruleName);
+    if (it != mappedRules.end())
+        return it->second;
+
+    RuleOfExistence* rule = RuleFactory::getInstance().createAndReturnRule(cells, ruleName);
+    mappedRules[ruleName] = rule;
+    return rule;
 }
 
 // Send cells map to FileLoader, which will populate its culture based on file values.
 void Population::buildCellCultureFromFile() {
     FileLoader fileLoader;
-    fileLoader.loadPopulationFromFile(cells);
+    if (slabLastRow >= 0)
+        fileLoader.loadPopulationFromFile(cells, world.fileName, world.dimensions, max(0, slabFirstRow - 1),
+                                          slabLastRow + 1);
+    else
+        fileLoader.loadPopulationFromFile(cells, world.fileName, world.dimensions);
 }
 
 // Build cell culture based on randomized starting values.
 void Population::randomizeCellCulture() {
-    default_random_engine generator(static_cast<unsigned>(time(nullptr)));
-    uniform_int_distribution<int> random(0, 1);
+    int width = world.dimensions.WIDTH + 2;
+    int height = world.dimensions.HEIGHT + 2;
+    double density = min(1.0, max(0.0, world.randomFill.liveDensity));
 
-    // allocate and map cells based on worldSize
-    for (int row = 0; row <= WORLD_DIMENSIONS.HEIGHT + 1; row++) {
+    // a slab only builds its own rows and the halo rows around them
+    int firstBuilt = 0, lastBuilt = height - 1;
+    if (slabLastRow >= 0) {
+        firstBuilt = max(0, slabFirstRow - 1);
+        lastBuilt = min(height - 1, slabLastRow + 1);
+    }
 
-        for (int column = 0; column <= WORLD_DIMENSIONS.WIDTH + 1; column++) {
-            // if cell is a rim cell
-            if (column == 0 || row == 0
-                || column == WORLD_DIMENSIONS.WIDTH + 1
-                || row == WORLD_DIMENSIONS.HEIGHT + 1) {
+    // fill a dense grid in chunks of rows, each with its own stream derived from the seed
+    vector<unsigned char> alive(static_cast<size_t>(width) * (lastBuilt - firstBuilt + 1), 0);
+    size_t firstChunk = max(0, firstBuilt - 1) / RANDOM_CHUNK_ROWS;
+    size_t chunks = (min(world.dimensions.HEIGHT, lastBuilt) + RANDOM_CHUNK_ROWS - 1) / RANDOM_CHUNK_ROWS;
+    auto fillChunk = [&](size_t chunk) {
+        seed_seq seeds{world.randomFill.seed, static_cast<unsigned int>(chunk)};
+        mt19937 generator(seeds);
+        bernoulli_distribution random(density);
 
-                cells[Point{column, row}] = Cell(true); // create a cell with rimCell state set to true
-            }
-            else { // If cell is an ordinary cell
-                if (random(generator)) { // Randomly pick alive/dead
-                    cells[Point{column, row}] = Cell(false, GIVE_CELL_LIFE); // create a ordinary living cell
-                }
-                else {
-                    cells[Point{column, row}] = Cell(false, IGNORE_CELL); // else create a ordinary dead cell
-                }
+        // every row of the chunk is drawn, so the rows kept are the same as in the whole world
+        int firstRow = 1 + static_cast<int>(chunk) * RANDOM_CHUNK_ROWS;
+        int lastRow = min(world.dimensions.HEIGHT, firstRow + RANDOM_CHUNK_ROWS - 1);
+        for (int row = firstRow; row <= lastRow; row++) {
+            bool kept = row >= firstBuilt && row <= lastBuilt;
+            for (int column = 1; column <= world.dimensions.WIDTH; column++) {
+                bool isAlive = random(generator);
+                if (kept)
+                    alive[static_cast<size_t>(row - firstBuilt) * width + column] = isAlive ? 1 : 0;
             }
         }
+    };
+
+    // the chunks are the same whatever thread fills them, so the world only depends on the seed
+    if (threadPool != nullptr) {
+        size_t poolWorkers = static_cast<size_t>(threadPool->getThreadCount());
+        threadPool->run([&](int worker) {
+            for (size_t chunk = firstChunk + worker; chunk < chunks; chunk += poolWorkers)
+                fillChunk(chunk);
+        });
+    }
+    else {
+        for (size_t chunk = firstChunk; chunk < chunks; chunk++)
+            fillChunk(chunk);
+    }
+
+    // the points are inserted in the order of the map, so each insertion is at the end
+    cells.clear();
+    for (int column = 0; column < width; column++) {
+        for (int row = firstBuilt; row <= lastBuilt; row++) {
+            // if cell is a rim cell
+            if (column == 0 || row == 0 || column == width - 1 || row == height - 1)
+                cells.emplace_hint(cells.end(), Point{column, row}, Cell(true));
+            else if (alive[static_cast<size_t>(row - firstBuilt) * width + column])
+                cells.emplace_hint(cells.end(), Point{column, row}, Cell(false, GIVE_CELL_LIFE));
+            else
+                cells.emplace_hint(cells.end(), Point{column, row}, Cell(false, IGNORE_CELL));
+        }
     }
 }
 
@@ -66,22 +376,222 @@ void Population::randomizeCellCulture() {
 Population::~Population() {
         delete evenRuleOfExistence;
         delete oddRuleOfExistence;
+
+        for (auto & rule : mappedRules)
+            delete rule.second;
+
+        delete scheduler;
+        delete threadPool;
+        delete snapshots;
+}
+
+// Execute the rules of the current generation for a range of tiles.
+void Population::executeTiles(size_t firstTile, size_t lastTile) {
+    for (size_t tile = firstTile; tile < lastTile; tile++) {
+        if (generation % 2 == 0) {
+            ruleTiles[tile].evenRule->executeRule(ruleTiles[tile].region);
+        }
+        else {
+            ruleTiles[tile].oddRule->executeRule(ruleTiles[tile].region);
+        }
+    }
 }
 
 // Update the cell population and determine next generational changes based on rules.
 int Population::calculateNewGeneration() {
+    if (cellsPlacementPending && threadPool != nullptr)
+        placeCellsOnWorkers();
+    cellsPlacementPending = false;
 
-    // update the states of cells
-    for (auto & cell : cells) {
-        cell.second.updateState();
+    // update the states of cells, all tiles are updated before any rule is executed
+    if (scheduler != nullptr) {
+        scheduler->run(allTiles, [this](int worker, size_t tile) {
+            auto start = chrono::steady_clock::now();
+            bool alive = false;
+            for (auto & cell : tileCells[tile]) {
+                cell->updateState();
+                alive = alive || cell->isAlive();
+            }
+            tileAlive[tile] = alive ? 1 : 0;
+            countTraffic(worker, tile, tile + 1, start);
+        });
+    }
+    else if (threadPool != nullptr) {
+        threadPool->run([this](int band) {
+            auto start = chrono::steady_clock::now();
+            for (size_t tile = bandStarts[band]; tile < bandStarts[band + 1]; tile++) {
+                for (auto & cell : tileCells[tile])
+                    cell->updateState();
+            }
+            countTraffic(band, bandStarts[band], bandStarts[band + 1], start);
+        });
+    }
+    else {
+        for (auto & cell : cells) {
+            cell.second.updateState();
+        }
+    }
+
+    // both generations are calculated by the composed kernel
+    if (getGenerationsPerSweep() == 2) {
+        calculateTwoGenerations();
+        generation += 2;
+        publishSnapshot();
+        return generation;
     }
 
-    // alternate between even / odd rule
-    if (generation % 2 == 0) {
-        evenRuleOfExistence->executeRule();
+    // alternate between even / odd rule, dispatched per tile
+    vector<RuleOfExistence*>& rules = (generation % 2 == 0) ? evenRules : oddRules;
+    for (auto & rule : rules)
+        rule->beginGeneration();
+
+    if (scheduler != nullptr) {
+        scheduler->run(findActiveTiles(rules), [this](int worker, size_t tile) {
+            auto start = chrono::steady_clock::now();
+            executeTiles(tile, tile + 1);
+            countTraffic(worker, tile, tile + 1, start);
+        });
+    }
+    else if (threadPool != nullptr) {
+        threadPool->run([this](int band) {
+            auto start = chrono::steady_clock::now();
+            executeTiles(bandStarts[band], bandStarts[band + 1]);
+            countTraffic(band, bandStarts[band], bandStarts[band + 1], start);
+        });
     }
     else {
-        oddRuleOfExistence->executeRule();
+        executeTiles(0, ruleTiles.size());
     }
+
+    for (auto & rule : rules)
+        rule->endGeneration();
+    ++generation;
+    publishSnapshot();
+    return generation;
+}
+
+// Update the states of the cells of the tiles only.
+void Population::updateTiles(size_t firstTile, size_t lastTile) {
+    for (size_t tile = firstTile; tile < lastTile; tile++) {
+        for (auto & cell : tileCells[tile])
+            cell->updateState();
+    }
+}
+
+// Execute the rules of the generation for the tiles only.
+int Population::executeRulesForTiles(size_t firstTile, size_t lastTile) {
+    vector<RuleOfExistence*>& rules = (generation % 2 == 0) ? evenRules : oddRules;
+    for (auto & rule : rules)
+        rule->beginGeneration();
+
+    executeTiles(firstTile, lastTile);
+
+    for (auto & rule : rules)
+        rule->endGeneration();
     return ++generation;
-}
\ No newline at end of file
+}
+
+// Rules with step tables only read the 3x3 neighbourhood of each cell.
+bool Population::hasLocalRules() {
+    vector<unsigned char> table;
+    for (auto & rule : evenRules) {
+        if (!rule->getStepTable(table))
+            return false;
+    }
+    for (auto & rule : oddRules) {
+        if (!rule->getStepTable(table))
+            return false;
+    }
+    return true;
+}
+
+// Copy the shown state of every cell into the frame, row by row.
+void Population::takeSnapshot(Frame& frame) {
+    frame.generation = generation;
+    frame.width = 0;
+    frame.height = 0;
+    if (!cells.empty()) {
+        frame.width = cells.rbegin()->first.x + 1;
+        frame.height = cells.rbegin()->first.y + 1;
+    }
+
+    size_t size = static_cast<size_t>(frame.width) * frame.height;
+    frame.values.resize(size);
+    frame.colors.resize(size);
+    frame.alive.resize(size);
+
+    for (auto & cell : cells) {
+        size_t index = frame.index(cell.first.x, cell.first.y);
+        frame.values[index] = cell.second.getCellValue();
+        frame.colors[index] = cell.second.getColor();
+        frame.alive[index] = cell.second.isAlive() ? 1 : 0;
+    }
+}
+
+// Keep snapshots of the generations, starting with the current one.
+void Population::enableSnapshots(int buffers) {
+    delete snapshots;
+    snapshots = new GenerationSnapshots(buffers);
+    publishSnapshot();
+}
+
+// Publish the current generation, unless every buffer is pinned by readers.
+void Population::publishSnapshot() {
+    if (snapshots == nullptr)
+        return;
+
+    Frame* frame = snapshots->beginWrite();
+    if (frame != nullptr) {
+        takeSnapshot(*frame);
+        snapshots->publish();
+    }
+}
+
+// Pin the newest published generation.
+PinnedFrame Population::pinGeneration() {
+    return (snapshots != nullptr) ? snapshots->pin() : PinnedFrame();
+}
+
+// Sets the action and color of a cell going from one state to the next, as Conway does.
+static void setNextState(Cell& cell, bool isAlive, bool aliveNext) {
+    ACTION action;
+    if (isAlive)
+        action = aliveNext ? IGNORE_CELL : KILL_CELL;
+    else
+        action = aliveNext ? GIVE_CELL_LIFE : DO_NOTHING;
+
+    if (action == KILL_CELL)
+        cell.setNextColor(STATE_COLORS.DEAD);
+
+    else if (action == GIVE_CELL_LIFE)
+        cell.setNextColor(STATE_COLORS.LIVING);
+
+    cell.setNextGenerationAction(action);
+}
+
+// Advance two generations with one sweep of the composed kernel.
+void Population::calculateTwoGenerations() {
+    Point origin = cells.begin()->first;
+    Point last = cells.rbegin()->first;
+    int width = last.x - origin.x + 1;
+    int height = last.y - origin.y + 1;
+
+    // pack the world into a dense grid
+    vector<unsigned char> current(width * height, 0), middle, next;
+    for (auto & cell : cells)
+        current[(cell.first.y - origin.y) * width + (cell.first.x - origin.x)] = cell.second.isAlive() ? 1 : 0;
+
+    TwoStepKernel& kernel = (generation % 2 == 0) ? evenKernel : oddKernel;
+    kernel.advance(current, middle, next, width, height);
+
+    // the first generation is applied, the second is left for the next update
+    for (auto & cell : cells) {
+        if (cell.second.isRimCell())
+            continue;
+
+        int index = (cell.first.y - origin.y) * width + (cell.first.x - origin.x);
+        setNextState(cell.second, current[index] != 0, middle[index] != 0);
+        cell.second.updateState();
+        setNextState(cell.second, middle[index] != 0, next[index] != 0);
+    }
+}
@@ -0,0 +1,103 @@
+/*
+ * Filename    DownsampledRenderer.cpp
+ * Author      Group 11
+ * Date        October 2026
+ * Version     0.3
+*/
+
+#include "DownsampledRenderer.h"
+#include <algorithm>
+#include <bit>
+
+/// @brief First Braille character, without dots.
+const uint32_t BRAILLE_BLANK = 0x2800;
+
+/// @brief Bit of each dot of a Braille character, by dot row and dot column.
+const uint32_t BRAILLE_DOTS[4][2] = {{0x01, 0x08}, {0x02, 0x10}, {0x04, 0x20}, {0x40, 0x80}};
+
+/// @brief Half block characters, by lit upper dot and lit lower dot.
+const uint32_t HALF_BLOCKS[2][2] = {{' ', 0x2584}, {0x2580, 0x2588}};
+
+// The packed rows cover the dots of every character.
+DownsampledRenderer::DownsampledRenderer(DownsampleMode mode, const Viewport& viewport, int columns, int rows)
+        : mode(mode), viewport(viewport), columns(columns), rows(rows) {
+    if (this->viewport.zoom < 1)
+        this->viewport.zoom = 1;
+    bitColumns = columns * dotsWide(mode) * this->viewport.zoom;
+    bitRows = rows * dotsHigh(mode) * this->viewport.zoom;
+    wordsPerRow = (bitColumns + 63) / 64;
+    bits.assign(static_cast<size_t>(wordsPerRow) * bitRows, 0);
+    glyphs.assign(static_cast<size_t>(columns) * rows, ' ');
+}
+
+// Only the cells inside both the viewport and the world are read, the rest stay dead.
+void DownsampledRenderer::packViewport(const Frame& frame) {
+    fill(bits.begin(), bits.end(), 0);
+
+    // world cells are at 1 to width - 2 of the frame, the rim is never alive
+    int firstColumn = max(viewport.column + 1, 1);
+    int firstRow = max(viewport.row + 1, 1);
+
+    // a viewport starting before the world leaves its first dots dead
+    int firstBitColumn = firstColumn - (viewport.column + 1);
+    int firstBitRow = firstRow - (viewport.row + 1);
+    int shownColumns = min(bitColumns - firstBitColumn, frame.width - 1 - firstColumn);
+    int shownRows = min(bitRows - firstBitRow, frame.height - 1 - firstRow);
+
+    for (int row = 0; row < shownRows; row++) {
+        const unsigned char* alive = frame.alive.data() + frame.index(firstColumn, firstRow + row);
+        uint64_t* words = bits.data() + static_cast<size_t>(firstBitRow + row) * wordsPerRow;
+        for (int column = 0; column < shownColumns; column++) {
+            int bit = firstBitColumn + column;
+            words[bit >> 6] |= static_cast<uint64_t>(alive[column] != 0) << (bit & 63);
+        }
+    }
+}
+
+// Popcount the bits of the dot in each of its rows, a word at a time.
+int DownsampledRenderer::countAlive(int dotColumn, int dotRow) const {
+    int zoom = viewport.zoom;
+    int first = dotColumn * zoom;
+    int last = first + zoom;
+    int count = 0;
+    for (int row = dotRow * zoom; row < (dotRow + 1) * zoom; row++) {
+        const uint64_t* words = bits.data() + static_cast<size_t>(row) * wordsPerRow;
+        for (int column = first; column < last; column = (column | 63) + 1) {
+            int end = min(last, (column | 63) + 1);
+            uint64_t mask = (end - column == 64) ? ~0ULL : (((1ULL << (end - column)) - 1) << (column & 63));
+            count += popcount(words[column >> 6] & mask);
+        }
+    }
+    return count;
+}
+
+// Light each dot with a quarter of its cells alive, and combine the dots of each character.
+const vector<uint32_t>& DownsampledRenderer::render(const Frame& frame) {
+    packViewport(frame);
+
+    int cellsPerDot = viewport.zoom * viewport.zoom;
+    int wide = dotsWide(mode);
+    int high = dotsHigh(mode);
+    for (int row = 0; row < rows; row++) {
+        for (int column = 0; column < columns; column++) {
+            bool lit[4][2] = {};
+            for (int dotRow = 0; dotRow < high; dotRow++)
+                for (int dotColumn = 0; dotColumn < wide; dotColumn++)
+                    lit[dotRow][dotColumn] =
+                            countAlive(column * wide + dotColumn, row * high + dotRow) * 4 >= cellsPerDot;
+
+            uint32_t glyph;
+            if (mode == DownsampleMode::BRAILLE) {
+                glyph = BRAILLE_BLANK;
+                for (int dotRow = 0; dotRow < 4; dotRow++)
+                    for (int dotColumn = 0; dotColumn < 2; dotColumn++)
+                        if (lit[dotRow][dotColumn])
+                            glyph |= BRAILLE_DOTS[dotRow][dotColumn];
+            }
+            else
+                glyph = HALF_BLOCKS[lit[0][0]][lit[1][0]];
+            glyphs[static_cast<size_t>(row) * columns + column] = glyph;
+        }
+    }
+    return glyphs;
+}
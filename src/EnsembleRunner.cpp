@@ -0,0 +1,81 @@
+/*
+ * Filename    EnsembleRunner.cpp
+ * Author      Group 11
+ * Date        October 2026
+ * Version     0.3
+*/
+
+#include "EnsembleRunner.h"
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <unordered_map>
+#include "Support/ThreadPool.h"
+
+// Remember what every population is made from.
+EnsembleRunner::EnsembleRunner(const WorldSettings& world, const string& evenRuleName,
+                               const string& oddRuleName, const string& ruleMapFileName,
+                               int maxGenerations, int threadCount)
+        : world(world), evenRuleName(evenRuleName), oddRuleName(oddRuleName),
+          ruleMapFileName(ruleMapFileName), maxGenerations(maxGenerations),
+          threadCount(threadCount > 1 ? threadCount : 1) {
+    this->world.fileName.clear();
+}
+
+// Simulate until the alive cells repeat, or the last generation.
+EnsembleResult EnsembleRunner::runSeed(unsigned int seed) {
+    WorldSettings seedWorld = world;
+    seedWorld.randomFill.seed = seed;
+    Population population;
+    population.setWorld(seedWorld);
+    population.initiatePopulation(evenRuleName, oddRuleName, ruleMapFileName);
+
+    EnsembleResult result{seed, -1, 0, 0};
+    // the generation and packed alive cells of each state, by checksum
+    unordered_multimap<unsigned long long, pair<int, vector<uint64_t>>> seenStates;
+    vector<uint64_t> packed;
+    Frame frame;
+    for (int step = 0; step < maxGenerations; step++) {
+        // the cells show the generation before the one returned
+        int shownGeneration = population.calculateNewGeneration() - 1;
+        population.takeSnapshot(frame);
+        unsigned long long hash = frame.aliveChecksum();
+
+        // a state only repeats if the alive cells are the same, not just the checksum
+        packed.assign((frame.alive.size() + 63) / 64, 0);
+        for (size_t cell = 0; cell < frame.alive.size(); cell++)
+            packed[cell >> 6] |= static_cast<uint64_t>(frame.alive[cell] != 0) << (cell & 63);
+        auto seen = seenStates.equal_range(hash);
+        auto repeated = find_if(seen.first, seen.second, [&packed](const auto& state) {
+            return state.second.second == packed;
+        });
+        if (repeated != seen.second) {
+            result.stabilisationGeneration = repeated->second.first;
+            result.period = shownGeneration - repeated->second.first;
+            break;
+        }
+        seenStates.emplace(hash, make_pair(shownGeneration, packed));
+    }
+
+    for (unsigned char alive : frame.alive)
+        result.finalPopulation += alive;
+    return result;
+}
+
+// Let the threads take seeds until every seed is done.
+vector<EnsembleResult> EnsembleRunner::run(int seeds) {
+    vector<EnsembleResult> results(seeds > 0 ? seeds : 0);
+    atomic<int> nextSeed(0);
+    auto work = [&](int) {
+        for (int index = nextSeed++; index < seeds; index = nextSeed++)
+            results[index] = runSeed(world.randomFill.seed + static_cast<unsigned int>(index));
+    };
+
+    if (threadCount > 1) {
+        ThreadPool pool(threadCount);
+        pool.run(work);
+    }
+    else
+        work(0);
+    return results;
+}
@@ -0,0 +1,199 @@
+/*
+ * Filename    FrameStreamer.cpp
+ * Author      Group 11
+ * Date        October 2026
+ * Version     0.3
+*/
+
+#include "FrameStreamer.h"
+#include <cerrno>
+#include <cmath>
+#include <csignal>
+#include <fcntl.h>
+#include <iostream>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace {
+
+    /// @brief First bytes of every stream.
+    const char STREAM_MAGIC[8] = {'G', 'O', 'L', 'R', 'A', 'W', '0', '1'};
+
+    /// @brief Pipe size when the kernel can not be asked for it.
+    const size_t DEFAULT_PIPE_SIZE = 65536;
+
+    // Append a number as four bytes, least significant first
+    void appendLittleEndian(string& bytes, uint32_t value) {
+        bytes.push_back(static_cast<char>(value));
+        bytes.push_back(static_cast<char>(value >> 8));
+        bytes.push_back(static_cast<char>(value >> 16));
+        bytes.push_back(static_cast<char>(value >> 24));
+    }
+}
+
+// Open the file or pipe, the standard output for "-"
+FrameStreamer::FrameStreamer(const string& path, PixelFormat format, double framesPerSecond)
+        : fd(STDOUT_FILENO), ownsFd(false), isPipe(false), format(format),
+          framesPerSecond(framesPerSecond > 0.0 ? framesPerSecond : DEFAULT_STREAM_FPS) {
+    if (path != "-") {
+        fd = open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+        if (fd < 0) {
+            cout << "Could not open the stream " << path << endl;
+            throw ios_base::failure("Could not open the stream");
+        }
+        ownsFd = true;
+    }
+
+    struct stat status{};
+    isPipe = fstat(fd, &status) == 0 && S_ISFIFO(status.st_mode);
+    stats.spliced = isPipe;
+
+    // a reader closing the stream is seen as EPIPE, instead of ending the program
+    signal(SIGPIPE, SIG_IGN);
+}
+
+// Close what was opened
+FrameStreamer::~FrameStreamer() {
+    if (ownsFd)
+        close(fd);
+}
+
+// Render the frame into the next buffer, and hand it to the kernel
+void FrameStreamer::writeFrame(const Frame& frame) {
+    if (stats.closed)
+        return;
+
+    int width = frame.width - 2, height = frame.height - 2;
+    size_t frameBytes = static_cast<size_t>(width) * height * (format == PixelFormat::RGB ? 3 : 1);
+    string header;
+    if (buffers.empty()) {
+        allocateBuffers(frameBytes);
+        header = makeHeader(width, height, format, framesPerSecond);
+    }
+    else if (buffers[0].size() != frameBytes)
+        return;
+
+    vector<unsigned char>& pixels = buffers[nextBuffer];
+    nextBuffer = (nextBuffer + 1) % buffers.size();
+    render(frame, pixels);
+
+    bool written;
+    if (isPipe) {
+        // the header is copied, the pixels are given
+        iovec headerVector{header.data(), header.size()};
+        written = (header.empty() || writeVectors(&headerVector, 1)) && splice(pixels.data(), pixels.size());
+    }
+    else {
+        iovec vectors[2] = {{header.data(), header.size()}, {pixels.data(), pixels.size()}};
+        written = header.empty() ? writeVectors(&vectors[1], 1) : writeVectors(vectors, 2);
+    }
+
+    if (written)
+        stats.frames++;
+    else
+        stats.closed = true;
+}
+
+// One pixel per cell, rim excluded
+void FrameStreamer::render(const Frame& frame, vector<unsigned char>& pixels) const {
+    int width = frame.width - 2, height = frame.height - 2;
+    int bytesPerPixel = format == PixelFormat::RGB ? 3 : 1;
+    pixels.resize(static_cast<size_t>(width) * height * bytesPerPixel);
+
+    unsigned char* pixel = pixels.data();
+    for (int row = 1; row <= height; row++) {
+        const COLOR* colors = frame.colors.data() + frame.index(1, row);
+        for (int column = 0; column < width; column++) {
+            unsigned char index = paletteIndex(colors[column]);
+            if (bytesPerPixel == 1) {
+                *pixel++ = index;
+            }
+            else {
+                *pixel++ = COLOR_RGB[index][0];
+                *pixel++ = COLOR_RGB[index][1];
+                *pixel++ = COLOR_RGB[index][2];
+            }
+        }
+    }
+}
+
+// The pipe holds at most its size in bytes, so a buffer is only reused once more than that has been given after it
+void FrameStreamer::allocateBuffers(size_t frameBytes) {
+    size_t count = 1;
+    if (isPipe) {
+        size_t pipeSize = DEFAULT_PIPE_SIZE;
+#ifdef F_GETPIPE_SZ
+        int size = fcntl(fd, F_GETPIPE_SZ);
+        if (size > 0)
+            pipeSize = static_cast<size_t>(size);
+#endif
+        count = pipeSize / (frameBytes > 0 ? frameBytes : 1) + 2;
+    }
+    buffers.assign(count, vector<unsigned char>(frameBytes));
+}
+
+// Write until every vector is written, partial writes advance the vectors
+bool FrameStreamer::writeVectors(iovec* vectors, int count) {
+    while (count > 0) {
+        ssize_t result = writev(fd, vectors, count);
+        stats.writeCalls++;
+        if (result < 0) {
+            if (errno == EINTR)
+                continue;
+            return false;
+        }
+        stats.bytes += static_cast<unsigned long long>(result);
+
+        size_t written = static_cast<size_t>(result);
+        while (count > 0 && written >= vectors->iov_len) {
+            written -= vectors->iov_len;
+            vectors++;
+            count--;
+        }
+        if (count > 0) {
+            vectors->iov_base = static_cast<char*>(vectors->iov_base) + written;
+            vectors->iov_len -= written;
+        }
+    }
+    return true;
+}
+
+// Give the pages to the pipe, or write them where vmsplice is not available
+bool FrameStreamer::splice(const unsigned char* data, size_t size) {
+    iovec vector{const_cast<unsigned char*>(data), size};
+#ifdef __linux__
+    while (vector.iov_len > 0) {
+        ssize_t result = vmsplice(fd, &vector, 1, 0);
+        stats.writeCalls++;
+        if (result < 0 && errno == EINTR)
+            continue;
+        if (result < 0 && (errno == EINVAL || errno == ENOSYS)) {
+            isPipe = false;
+            stats.spliced = false;
+            break;
+        }
+        if (result < 0)
+            return false;
+        stats.bytes += static_cast<unsigned long long>(result);
+        vector.iov_base = static_cast<char*>(vector.iov_base) + result;
+        vector.iov_len -= static_cast<size_t>(result);
+    }
+    if (vector.iov_len == 0)
+        return true;
+#endif
+    return writeVectors(&vector, 1);
+}
+
+// Magic, size, rate, pixel format and palette, padded with zeros
+string FrameStreamer::makeHeader(int width, int height, PixelFormat format, double framesPerSecond) {
+    string header(STREAM_MAGIC, sizeof(STREAM_MAGIC));
+    appendLittleEndian(header, static_cast<uint32_t>(width));
+    appendLittleEndian(header, static_cast<uint32_t>(height));
+    appendLittleEndian(header, static_cast<uint32_t>(lround(framesPerSecond * 1000.0)));
+    appendLittleEndian(header, 1000);
+    appendLittleEndian(header, static_cast<uint32_t>(format));
+    appendLittleEndian(header, static_cast<uint32_t>(width) * height * (format == PixelFormat::RGB ? 3 : 1));
+    header.append(reinterpret_cast<const char*>(COLOR_RGB), sizeof(COLOR_RGB));
+    header.resize(STREAM_HEADER_SIZE, '\0');
+    return header;
+}
@@ -6,34 +6,156 @@
 */
 
 #include "GameOfLife.h"
+#include <atomic>
 #include <thread>
 #include <chrono>
+#include "Support/FrameRing.h"
+#include "Support/Pacer.h"
 #include "GoL_Rules/RuleFactory.h"
 
-GameOfLife::GameOfLife(int nrOfGenerations, string evenRuleName, string oddRuleName)
+GameOfLife::GameOfLife(int nrOfGenerations, string evenRuleName, string oddRuleName,
+                       const string& ruleMapFileName, const WorldSettings& world, int tileSize,
+                       int threadCount)
         : nrOfGenerations(nrOfGenerations), screenPrinter(ScreenPrinter::getInstance()) {
 
     // initiate population
-    population.initiatePopulation(evenRuleName, oddRuleName);
+    population.setWorld(world);
+    population.setTileSize(tileSize);
+    population.setThreadCount(threadCount);
+    population.initiatePopulation(evenRuleName, oddRuleName, ruleMapFileName);
+}
+
+// Calculate every generation as fast as possible, and describe the last one.
+HeadlessStats GameOfLife::runHeadless() {
+    int firstGeneration = population.getGeneration();
+    GenerationView generation(population);
+    auto start = chrono::steady_clock::now();
+    if (exporter != nullptr)
+        exporter->offer(generation);
+    while (population.getGeneration() < nrOfGenerations) {
+        // a sweep of two generations would pass the last one, so it is calculated on its own
+        bool singleStep = population.getGeneration() + population.getGenerationsPerSweep() > nrOfGenerations;
+        if (singleStep)
+            population.setGenerationsPerSweep(1);
+        population.calculateNewGeneration();
+        if (singleStep)
+            population.setGenerationsPerSweep(2);
+        if (exporter != nullptr)
+            exporter->offer(generation);
+    }
+    double seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+
+    Frame frame;
+    population.takeSnapshot(frame);
+    int alive = 0;
+    for (unsigned char cell : frame.alive)
+        alive += cell;
+
+    const Dimensions& dimensions = population.getWorldDimensions();
+    int generations = population.getGeneration() - firstGeneration;
+    unsigned long long cellsPerGeneration = static_cast<unsigned long long>(dimensions.WIDTH) * dimensions.HEIGHT;
+    return HeadlessStats{generations, seconds, cellsPerGeneration * generations, frame.aliveChecksum(), alive};
 }
 
 /*
 * Run the simulation for as many generations as been set by the user (default = 500).
-* For each iteration; calculate population changes and print the information on screen.
+* The generations are calculated on a thread of their own and published as frames,
+* the calling thread prints the newest frame whenever it is done with the previous one,
+* or writes it to the stream instead. Each thread is paced to its own rate, if one has been set.
 */
 void GameOfLife::runSimulation() {
 
-    // Clears the terminal
-    screenPrinter.clearScreen();
+    // Clears the terminal, unless the frames are streamed
+    if (streamer == nullptr)
+        screenPrinter.clearScreen();
+
+    FrameRing frames(FRAME_RING_SIZE);
+    atomic<bool> simulationDone(false);
+    exception_ptr simulationFailure;
+
+    // Print or stream a frame
+    auto showFrame = [this](const Frame& frame) {
+        if (streamer != nullptr)
+            streamer->writeFrame(frame);
+        else
+            screenPrinter.printBoard(frame);
+    };
+
+    Pacer generationPacer(generationsPerSecond);
+    Pacer framePacer(framesPerSecond);
+
+    // Show generation zero before the simulation thread can publish newer frames
+    Frame firstFrame;
+    population.takeSnapshot(firstFrame);
+    showFrame(firstFrame);
+    framePacer.wait();
 
-    // Print generation zero
-    screenPrinter.printBoard(population);
+    thread simulation([this, &frames, &simulationDone, &simulationFailure, &generationPacer] {
+        try {
+            // For each generation after the shown one
+            GenerationStream stream = generations();
+            auto generation = stream.begin();
+            if (exporter != nullptr)
+                exporter->offer(*generation);
+            for (++generation; generation != stream.end(); ++generation) {
+                // the exporter only copies the generations due for an image
+                if (exporter != nullptr)
+                    exporter->offer(*generation);
 
-    // For each generation
-    while (population.calculateNewGeneration() < nrOfGenerations) {
-        // Print the calculated generation
-        screenPrinter.printBoard(population);
+                Frame* frame = frames.beginWrite();
 
-        this_thread::sleep_for(std::chrono::milliseconds(100));
+                // the last frame is always shown, wait for the printer to free a slot
+                bool lastFrame = generation->getGeneration() + population.getGenerationsPerSweep() >= nrOfGenerations;
+                while (frame == nullptr && lastFrame) {
+                    this_thread::yield();
+                    frame = frames.beginWrite();
+                }
+
+                // the printer is behind, skip this generation
+                if (frame != nullptr) {
+                    generation->takeSnapshot(*frame);
+                    frames.publish();
+                }
+
+                // sleep until the deadline of the next sweep
+                generationPacer.wait(population.getGenerationsPerSweep());
+            }
+        }
+        catch (...) {
+            simulationFailure = current_exception();
+        }
+        simulationDone = true;
+    });
+
+    while (true) {
+        // read before looking for frames, so no frame published before it is missed
+        bool done = simulationDone;
+
+        // do not queue frames in a terminal that is behind, the newest frame is printed when it has caught up
+        if (!done && screenPrinter.isTerminalBehind()) {
+            this_thread::sleep_for(chrono::milliseconds(1));
+            continue;
+        }
+
+        const Frame* frame = frames.acquireLatest();
+        if (frame != nullptr) {
+            // Print or stream the newest calculated generation
+            showFrame(*frame);
+            frames.release();
+
+            // sleep until the deadline of the next frame
+            framePacer.wait();
+        }
+        else if (done) {
+            break;
+        }
+        else {
+            this_thread::sleep_for(chrono::milliseconds(1));
+        }
     }
-}
\ No newline at end of file
+    simulation.join();
+    pacingStats = PacingStats{framePacer.getAchievedRate(), generationPacer.getAchievedRate()};
+
+    if (simulationFailure)
+        rethrow_exception(simulationFailure);
+}
@@ -0,0 +1,41 @@
+/*
+ * Filename    GenerationStream.cpp
+ * Author      Group 11
+ * Date        October 2026
+ * Version     0.3
+*/
+
+#include "GenerationStream.h"
+
+// Calculate the next sweep, if the stream has not ended.
+GenerationStream::iterator& GenerationStream::iterator::operator++() {
+    if (!atEnd())
+        view.getPopulation().calculateNewGeneration();
+    return *this;
+}
+
+// The end iterator, and a stream that has reached its last generation, are at the end.
+bool GenerationStream::iterator::atEnd() const {
+    return stream == nullptr || view.getGeneration() >= stream->lastGeneration;
+}
+
+// Calculate whole sweeps until the generations are skipped or the stream has ended.
+GenerationView GenerationStream::skip(int generations) {
+    int target = population.getGeneration() + generations;
+    while (population.getGeneration() < target && population.getGeneration() < lastGeneration)
+        population.calculateNewGeneration();
+    return GenerationView(population);
+}
+
+#ifdef GAMEOFLIFE_HAS_COROUTINES
+
+// Yield the current generation, then one view per sweep until the last generation.
+Generator<GenerationView> generateGenerations(Population& population, int lastGeneration) {
+    GenerationView view(population);
+    while (view.getGeneration() < lastGeneration) {
+        co_yield view;
+        population.calculateNewGeneration();
+    }
+}
+
+#endif
@@ -9,6 +9,15 @@
 #include "GoL_Rules/RuleOfExistence_Conway.h"
 #include "GoL_Rules/RuleOfExistence_VonNeumann.h"
 #include "GoL_Rules/RuleOfExistence_Erik.h"
+#include "GoL_Rules/RuleOfExistence_Plugin.h"
+
+#ifndef _WIN32
+#include <dirent.h>
+#include <dlfcn.h>
+#endif
+
+map<string, RuleFactory::RuleCreator> RuleFactory::registeredRules;
+vector<void*> RuleFactory::pluginHandles;
 
 // Singleton factory receiver.
 RuleFactory& RuleFactory::getInstance() {
@@ -18,6 +27,10 @@ RuleFactory& RuleFactory::getInstance() {
 
 // Creates and returns specified RuleOfExistence.
 RuleOfExistence* RuleFactory::createAndReturnRule(map<Point, Cell>& cells, const string& ruleName) {
+    auto registered = registeredRules.find(ruleName);
+    if (registered != registeredRules.end())
+        return registered->second(cells);
+
     if (ruleName == "von_neumann")
         return new RuleOfExistence_VonNeumann(cells);
     else if (ruleName == "erik")
@@ -25,4 +38,48 @@ RuleOfExistence* RuleFactory::createAndReturnRule(map<Point, Cell>& cells, const
 
     // defaults to Conway's rule
     return new RuleOfExistence_Conway(cells);
-}
\ No newline at end of file
+}
+
+// Registers a rule that can be created by name.
+void RuleFactory::registerRule(const string& ruleName, RuleCreator creator) {
+    registeredRules[ruleName] = creator;
+}
+
+// Loads and registers every rule plugin in the directory.
+int RuleFactory::loadPlugins(const string& directory) {
+    int loaded = 0;
+#ifndef _WIN32
+    DIR* dir = opendir(directory.c_str());
+    if (dir == nullptr)
+        return 0;
+
+    while (dirent* entry = readdir(dir)) {
+        string path = directory + "/" + entry->d_name;
+
+        // only shared libraries can be plugins
+        if (path.size() < 3 || path.compare(path.size() - 3, 3, ".so") != 0)
+            continue;
+
+        void* handle = dlopen(path.c_str(), RTLD_NOW | RTLD_LOCAL);
+        if (handle == nullptr)
+            continue;
+
+        auto entryFunction = reinterpret_cast<GoLRulePluginEntry>(dlsym(handle, GOL_RULE_PLUGIN_ENTRY));
+        const GoLRulePlugin* plugin = entryFunction ? entryFunction() : nullptr;
+        if (plugin == nullptr || plugin->abiVersion != GOL_RULE_PLUGIN_ABI_VERSION
+            || plugin->name == nullptr || plugin->step == nullptr) {
+            dlclose(handle);
+            continue;
+        }
+
+        // the plugin stays loaded, rules created from it points into the library
+        pluginHandles.push_back(handle);
+        registerRule(plugin->name, [plugin](map<Point, Cell>& cells) -> RuleOfExistence* {
+            return new RuleOfExistence_Plugin(cells, *plugin);
+        });
+        loaded++;
+    }
+    closedir(dir);
+#endif
+    return loaded;
+}
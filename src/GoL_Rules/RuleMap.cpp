@@ -0,0 +1,117 @@
+/*
+ * Filename    RuleMap.cpp
+ * Author      Group 11
+ * Date        October 2026
+ * Version     0.3
+*/
+
+#include "GoL_Rules/RuleMap.h"
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+
+// Collects the sorted positions along one axis where a new tile has to start.
+static vector<int> tileEdges(int first, int last, int tileSize, vector<int> areaEdges) {
+    vector<int> edges;
+
+    if (tileSize > 0) {
+        for (int position = first; position <= last; position += tileSize)
+            edges.push_back(position);
+    }
+    edges.push_back(first);
+    edges.push_back(last + 1);
+
+    // area edges outside of the world does not split anything
+    for (int edge : areaEdges) {
+        if (edge > first && edge <= last)
+            edges.push_back(edge);
+    }
+
+    sort(edges.begin(), edges.end());
+    edges.erase(unique(edges.begin(), edges.end()), edges.end());
+    return edges;
+}
+
+// Loads rule areas from file, one area per line.
+void RuleMap::loadFromFile(const string& ruleMapFileName) {
+
+    // Same handling as FileLoader, print a message and throw back to main
+    ifstream inFile(ruleMapFileName);
+    try {
+        if (!inFile.good()) {
+            throw ios_base::failure("");
+        }
+    }
+    catch (ios_base::failure &e) {
+        cout << "Could not find rule map file. Closing application." << endl;
+        throw;
+    }
+
+    string line;
+    int lineNumber = 0;
+    while (getline(inFile, line)) {
+        lineNumber++;
+
+        // skip empty lines and comments
+        size_t first = line.find_first_not_of(" \t\r");
+        if (first == string::npos || line[first] == '#')
+            continue;
+
+        istringstream iss(line);
+        int column, row, width, height;
+        char separator;
+        string evenRuleName, oddRuleName;
+
+        iss >> column >> row >> width >> separator >> height >> evenRuleName;
+        if (iss.fail() || separator != 'x' || width <= 0 || height <= 0) {
+            cout << "Invalid rule map line " << lineNumber << ". Closing application." << endl;
+            throw ios_base::failure("Invalid rule map line");
+        }
+        iss >> oddRuleName;
+
+        addArea(Region{Point{column, row}, Point{column + width - 1, row + height - 1}},
+                evenRuleName, oddRuleName);
+    }
+    inFile.close();
+}
+
+// Adds an area, if no odd rule is given the even rule is used for both.
+void RuleMap::addArea(const Region& region, const string& evenRuleName, string oddRuleName) {
+    if (oddRuleName.empty())
+        oddRuleName = evenRuleName;
+
+    areas.push_back(RuleArea{region, evenRuleName, oddRuleName});
+}
+
+// Splits the world into tiles, each covered by a single rule assignment.
+vector<RuleArea> RuleMap::partition(const Region& world, int tileSize) const {
+    vector<int> areaColumns, areaRows;
+    for (auto & area : areas) {
+        areaColumns.push_back(area.region.topLeft.x);
+        areaColumns.push_back(area.region.bottomRight.x + 1);
+        areaRows.push_back(area.region.topLeft.y);
+        areaRows.push_back(area.region.bottomRight.y + 1);
+    }
+
+    vector<int> columns = tileEdges(world.topLeft.x, world.bottomRight.x, tileSize, areaColumns);
+    vector<int> rows = tileEdges(world.topLeft.y, world.bottomRight.y, tileSize, areaRows);
+
+    vector<RuleArea> tiles;
+    for (size_t row = 0; row + 1 < rows.size(); row++) {
+        for (size_t column = 0; column + 1 < columns.size(); column++) {
+            RuleArea tile{Region{Point{columns[column], rows[row]},
+                                 Point{columns[column + 1] - 1, rows[row + 1] - 1}}, "", ""};
+
+            // the whole tile has the same assignment, the last area covering it wins
+            for (auto & area : areas) {
+                if (area.region.contains(tile.region.topLeft)) {
+                    tile.evenRuleName = area.evenRuleName;
+                    tile.oddRuleName = area.oddRuleName;
+                }
+            }
+            tiles.push_back(tile);
+        }
+    }
+    return tiles;
+}
@@ -47,9 +47,31 @@ ACTION RuleOfExistence::getAction(int aliveNeighbours, bool isAlive) {
     return DO_NOTHING;
 }
 
+// Tabulates getAction for every neighbourhood of a cell, using the directions of the rule.
+void RuleOfExistence::buildStepTable(vector<unsigned char>& table) {
+    table.assign(STEP_TABLE_SIZE, 0);
+
+    for (int neighbourhood = 0; neighbourhood < STEP_TABLE_SIZE; neighbourhood++) {
+        bool isAlive = (neighbourhood >> 4) & 1;
+
+        int aliveNeighbours = 0;
+        for (auto direction : DIRECTIONS) {
+            int bit = (direction.VERTICAL + 1) * 3 + (direction.HORIZONTAL + 1);
+            aliveNeighbours += (neighbourhood >> bit) & 1;
+        }
+
+        ACTION action = getAction(aliveNeighbours, isAlive);
+        bool aliveNext = (action == GIVE_CELL_LIFE) || (isAlive && action != KILL_CELL);
+        table[neighbourhood] = aliveNext ? 1 : 0;
+    }
+}
 
+// Executes the rule for a region covering the whole game board.
+void RuleOfExistence::executeRule() {
+    if (cells.empty())
+        return;
 
-
-
-
-
+    beginGeneration();
+    executeRule(Region{cells.begin()->first, cells.rbegin()->first});
+    endGeneration();
+}
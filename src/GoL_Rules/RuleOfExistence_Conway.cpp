@@ -7,19 +7,16 @@
 
 #include "GoL_Rules/RuleOfExistence_Conway.h"
 
-// Execute the rule specific for Conway.
-void RuleOfExistence_Conway::executeRule() {
-    for (auto & it : cells) {
-
-        // referens current cell
-        Cell& cell = it.second;
+// Execute the rule specific for Conway, for the cells inside the region.
+void RuleOfExistence_Conway::executeRule(const Region& region) {
+    forEachCellIn(region, [this](const Point& position, Cell& cell) {
 
         // Ignore cells that is part of the rim
         if (cell.isRimCell())
-            continue;
+            return;
 
         // get amount of alive neighbouring cells
-        int aliveNeighbours = countAliveNeighbours(it.first);
+        int aliveNeighbours = countAliveNeighbours(position);
 
         // determine action for cell
         ACTION action = getAction(aliveNeighbours, cell.isAlive());
@@ -32,5 +29,5 @@ void RuleOfExistence_Conway::executeRule() {
 
         // the cell will know what to do, based on this action
         cell.setNextGenerationAction(action);
-    }
+    });
 }
\ No newline at end of file
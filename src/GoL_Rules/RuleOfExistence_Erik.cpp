@@ -7,19 +7,65 @@
 
 #include "GoL_Rules/RuleOfExistence_Erik.h"
 
-// Execute the rule specific for Erik.
-void RuleOfExistence_Erik::executeRule() {
-    for (auto & it : cells) {
+namespace {
+
+    /**
+     * @brief The cells of a region, gathered into dense arrays for the Erik pass.
+     * @details One per thread, regions may be executed concurrently. The
+     * arrays keep their capacity, so only the first regions allocate.
+     */
+    struct ErikArrays {
+        vector<Cell*> regionCells;
+        vector<Point> positions;
+        vector<int> ages;
+        vector<unsigned char> killed;
+        vector<int> colors;
+        vector<char> currentValues;
+        vector<char> values;
+
+        // Empty the arrays, with room for the cells of the region
+        void reset(const Region& region) {
+            size_t area = static_cast<size_t>(region.bottomRight.x - region.topLeft.x + 1)
+                          * static_cast<size_t>(region.bottomRight.y - region.topLeft.y + 1);
+            regionCells.clear();
+            positions.clear();
+            ages.clear();
+            killed.clear();
+            colors.clear();
+            currentValues.clear();
+            values.clear();
+            regionCells.reserve(area);
+            positions.reserve(area);
+            ages.reserve(area);
+            killed.reserve(area);
+            colors.reserve(area);
+            currentValues.reserve(area);
+            values.reserve(area);
+        }
+    };
+}
 
-        // referens current cell
-        Cell& cell = it.second;
+// Execute the rule specific for Erik, for the cells inside the region.
+void RuleOfExistence_Erik::executeRule(const Region& region) {
+    thread_local ErikArrays arrays;
+    arrays.reset(region);
+    vector<Cell*>& regionCells = arrays.regionCells;
+    vector<Point>& positions = arrays.positions;
+    vector<int>& ages = arrays.ages;
+    vector<unsigned char>& killed = arrays.killed;
+    vector<int>& colors = arrays.colors;
+    vector<char>& currentValues = arrays.currentValues;
+    vector<char>& values = arrays.values;
+
+    // Conway transition
+    forEachCellIn(region, [&](const Point& position, Cell& cell) {
 
         // Ignore cells that is part of the rim
         if (cell.isRimCell())
-            continue;
+            return;
 
         // get amount of alive neighbouring cells
-        int aliveNeighbours = countAliveNeighbours(it.first);
+        int aliveNeighbours = countAliveNeighbours(position);
 
         // determine action for cell
         ACTION action = getAction(aliveNeighbours, cell.isAlive());
@@ -30,16 +76,50 @@ void RuleOfExistence_Erik::executeRule() {
         else if (action == GIVE_CELL_LIFE)
             cell.setNextColor(STATE_COLORS.LIVING);
 
-
-
-        // With age comes experience. Cells older than 5 generations recieves a cyan color.
-        // If the cell is older than 10 generations, it gets the value 'E' (for Erik) showing
-        // its total awesomeness.
-        erikfyCell(cell, action);
-
         // the cell will know what to do, based on this action
         cell.setNextGenerationAction(action);
+
+        regionCells.push_back(&cell);
+        positions.push_back(position);
+        ages.push_back(cell.getAge());
+        killed.push_back(action == KILL_CELL ? 1 : 0);
+        colors.push_back(static_cast<int>(cell.getNextColor()));
+        currentValues.push_back(cell.getCellValue());
+        values.push_back(cell.getNextCellValue());
+    });
+
+    // With age comes experience. Cells older than 5 generations recieves a cyan color.
+    // If the cell is older than 10 generations, it gets the value 'E' (for Erik) showing
+    // its total awesomeness.
+    erikfyCells(ages.data(), killed.data(), currentValues.data(), colors.data(), values.data(),
+                ages.size());
+
+    for (size_t i = 0; i < regionCells.size(); i++) {
+        regionCells[i]->setNextColor(static_cast<COLOR>(colors[i]));
+        regionCells[i]->setNextCellValue(values[i]);
     }
+
+    // best elder candidate of this region, merged into the generation when done
+    ElderCandidate candidate{Point{0, 0}, 0, false};
+    findElderCandidate(positions.data(), ages.data(), killed.data(), ages.size(), candidate);
+
+    lock_guard<mutex> lock(elderMutex);
+    generationElder.merge(candidate);
+}
+
+// Forget the candidate of the previous generation.
+void RuleOfExistence_Erik::beginGeneration() {
+    lock_guard<mutex> lock(elderMutex);
+    generationElder = ElderCandidate{Point{0, 0}, 0, false};
+}
+
+// The oldest cell of all regions becomes the prime elder.
+void RuleOfExistence_Erik::endGeneration() {
+    lock_guard<mutex> lock(elderMutex);
+    if (generationElder.found)
+        setPrimeElder(generationElder.position);
+    else
+        hasPrimeElder = false;
 }
 
 /*
@@ -48,33 +128,38 @@ void RuleOfExistence_Erik::executeRule() {
 * If the cell is older than 10 generations, it also gets the value 'E' (for Erik) signifying
 * a sentient lifeform of great wisdom. Thus proving, that intelligent life can be created using
 * cellular automata.
+* Written without branches, every cell is a select on its age, so the loops vectorizes.
 */
-void RuleOfExistence_Erik::erikfyCell(Cell& cell, ACTION action) {
-    if (action != KILL_CELL) {
-
-        int cellAge = cell.getAge();
-
-        // A somewhat old cell will get a color differentiating it
-        if (cellAge > 4)
-            cell.setNextColor(STATE_COLORS.OLD);
-
-        // A very old cell will get a value of 'E'
-        if (cellAge > 9) {
-            cell.setNextCellValue(usedCellValue);
-
-            // Determine prime elder, an extremely rare case where a cell has survived longer than any other.
-            if (primeElder == nullptr || cell.getAge() > primeElder->getAge())
-                setPrimeElder(&cell);
-        }
+void RuleOfExistence_Erik::erikfyCells(const int* ages, const unsigned char* killed,
+                                       const char* currentValues, int* colors, char* values,
+                                       size_t count) const {
+    const int oldColor = static_cast<int>(STATE_COLORS.OLD);
+    const char erikValue = usedCellValue;
+
+    // A somewhat old cell will get a color differentiating it
+    for (size_t i = 0; i < count; i++) {
+        int alive = killed[i] == 0;
+        int isOld = (ages[i] > 4) & alive;
+        colors[i] = isOld ? oldColor : colors[i];
     }
 
-        // An old cell dies, reset its value
-    else if (cell.getCellValue() == usedCellValue) {
-        cell.setNextCellValue('#');
+    // A very old cell will get a value of 'E', an old cell that dies is reset
+    for (size_t i = 0; i < count; i++) {
+        int alive = killed[i] == 0;
+        int isErik = (ages[i] > 9) & alive;
+        int isReset = (currentValues[i] == erikValue) & (alive ^ 1);
+        char value = isReset ? '#' : values[i];
+        values[i] = isErik ? erikValue : value;
+    }
+}
 
-        // if the cell is a prime elder, nullify pointer
-        if(&cell == primeElder)
-            primeElder = nullptr;
+// Determine prime elder candidate, an extremely rare case where a cell has survived longer than any other.
+void RuleOfExistence_Erik::findElderCandidate(const Point* positions, const int* ages,
+                                              const unsigned char* killed, size_t count,
+                                              ElderCandidate& candidate) const {
+    for (size_t i = 0; i < count; i++) {
+        if (killed[i] == 0 && ages[i] > 9)
+            candidate.merge(ElderCandidate{positions[i], ages[i], true});
     }
 }
 
@@ -82,10 +167,8 @@ void RuleOfExistence_Erik::erikfyCell(Cell& cell, ACTION action) {
 Sets the prime elder, a very rare occasion of a cell surviving longer than any other. Only one cell
 can be elder at a time.
 */
-void RuleOfExistence_Erik::setPrimeElder(Cell* newElder) {
-    if (primeElder != nullptr)
-        primeElder->setNextColor(STATE_COLORS.OLD);
-
+void RuleOfExistence_Erik::setPrimeElder(const Point& newElder) {
     primeElder = newElder;
-    primeElder->setNextColor(STATE_COLORS.ELDER);
+    hasPrimeElder = true;
+    cells.at(primeElder).setNextColor(STATE_COLORS.ELDER);
 }
\ No newline at end of file
@@ -0,0 +1,78 @@
+/*
+ * Filename    RuleOfExistence_Plugin.cpp
+ * Author      Group 11
+ * Date        October 2026
+ * Version     0.3
+*/
+
+#include "GoL_Rules/RuleOfExistence_Plugin.h"
+
+// Execute the rule of the plugin, for the cells inside the region.
+void RuleOfExistence_Plugin::executeRule(const Region& region) {
+    int left = region.topLeft.x;
+    int top = region.topLeft.y;
+    int width = region.bottomRight.x - left + 1;
+    int height = region.bottomRight.y - top + 1;
+    if (width <= 0 || height <= 0)
+        return;
+
+    // pack the region and a one cell halo into a dense grid, rim cells are never alive
+    int inStride = width + 2;
+    vector<unsigned char> in(inStride * (height + 2), 0);
+    vector<unsigned char> out(width * height, 0);
+    Region withHalo{Point{left - 1, top - 1}, Point{left + width, top + height}};
+    forEachCellIn(withHalo, [&](const Point& position, Cell& cell) {
+        in[(position.y - top + 1) * inStride + (position.x - left + 1)] = cell.isAlive() ? 1 : 0;
+    });
+
+    plugin.step(in.data(), inStride, out.data(), width, width, height);
+
+    // translate the result to actions
+    forEachCellIn(region, [&](const Point& position, Cell& cell) {
+
+        // Ignore cells that is part of the rim
+        if (cell.isRimCell())
+            return;
+
+        bool aliveNext = out[(position.y - top) * width + (position.x - left)] != 0;
+
+        ACTION action;
+        if (cell.isAlive())
+            action = aliveNext ? IGNORE_CELL : KILL_CELL;
+        else
+            action = aliveNext ? GIVE_CELL_LIFE : DO_NOTHING;
+
+        if (action == KILL_CELL)
+            cell.setNextColor(STATE_COLORS.DEAD);
+
+        else if (action == GIVE_CELL_LIFE)
+            cell.setNextColor(STATE_COLORS.LIVING);
+
+        // the cell will know what to do, based on this action
+        cell.setNextGenerationAction(action);
+    });
+}
+
+// Tabulate the plugin by stepping a single cell for every neighbourhood.
+bool RuleOfExistence_Plugin::getStepTable(vector<unsigned char>& table) {
+    table.assign(STEP_TABLE_SIZE, 0);
+
+    unsigned char in[9];
+    for (int neighbourhood = 0; neighbourhood < STEP_TABLE_SIZE; neighbourhood++) {
+        for (int bit = 0; bit < 9; bit++)
+            in[bit] = (neighbourhood >> bit) & 1;
+
+        unsigned char out = 0;
+        plugin.step(in, 3, &out, 1, 1, 1);
+        table[neighbourhood] = out != 0 ? 1 : 0;
+    }
+    return true;
+}
+
+// Step a single dead cell without alive neighbours.
+bool RuleOfExistence_Plugin::emptyStaysEmpty() {
+    unsigned char in[9] = {0};
+    unsigned char out = 0;
+    plugin.step(in, 3, &out, 1, 1, 1);
+    return out == 0;
+}
@@ -0,0 +1,50 @@
+/*
+ * Filename    TwoStepKernel.cpp
+ * Author      Group 11
+ * Date        October 2026
+ * Version     0.3
+*/
+
+#include "GoL_Rules/TwoStepKernel.h"
+
+// Spreads a column of three cells to its bits of a step table index.
+static inline int spreadColumn(int top, int center, int bottom) {
+    return top | (center << 3) | (bottom << 6);
+}
+
+// Calculate one row with a step table, sliding the 3x3 neighbourhood along the row.
+void TwoStepKernel::stepRow(const vector<unsigned char>& table, const vector<unsigned char>& from,
+                            vector<unsigned char>& to, int row, int width) {
+    const unsigned char* above = &from[(row - 1) * width];
+    const unsigned char* center = &from[row * width];
+    const unsigned char* below = &from[(row + 1) * width];
+    unsigned char* result = &to[row * width];
+
+    // the first two columns, moved to the left and center when the loop starts
+    int index = (spreadColumn(above[0], center[0], below[0]) << 1)
+                | (spreadColumn(above[1], center[1], below[1]) << 2);
+
+    for (int column = 1; column < width - 1; column++) {
+        // drop the leftmost column and add the column to the right
+        index = ((index >> 1) & 0x0DB)
+                | (spreadColumn(above[column + 1], center[column + 1], below[column + 1]) << 2);
+        result[column] = table[index];
+    }
+}
+
+// Advance two generations, the first generation is kept one row ahead of the second.
+void TwoStepKernel::advance(const vector<unsigned char>& current, vector<unsigned char>& middle,
+                            vector<unsigned char>& next, int width, int height) const {
+    // rim cells stays dead in both generations
+    middle.assign(current.size(), 0);
+    next.assign(current.size(), 0);
+
+    for (int row = 1; row < height; row++) {
+        if (row < height - 1)
+            stepRow(firstTable, current, middle, row, width);
+
+        // the three rows of the first generation around row - 1 are done
+        if (row - 1 >= 1)
+            stepRow(secondTable, middle, next, row - 1, width);
+    }
+}
@@ -0,0 +1,324 @@
+/*
+ * Filename    ImageExporter.cpp
+ * Author      Group 11
+ * Date        October 2026
+ * Version     0.3
+*/
+
+#include "ImageExporter.h"
+#include <array>
+#include <chrono>
+#include <cstdio>
+#include <dirent.h>
+#include <fstream>
+#include <iostream>
+
+namespace {
+
+    /// @brief Shortest and longest run written as a back reference.
+    const int MIN_RUN = 3, MAX_RUN = 258;
+
+    /// @brief Shortest run of each deflate length code, and its extra bits.
+    const int LENGTH_BASE[29] = {3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31,
+                                 35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258};
+    const int LENGTH_EXTRA[29] = {0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2,
+                                  3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0};
+
+    // The CRC-32 of PNG chunks, table built once
+    uint32_t crc32(const unsigned char* data, size_t length, uint32_t crc = 0) {
+        static const array<uint32_t, 256> table = [] {
+            array<uint32_t, 256> entries{};
+            for (uint32_t byte = 0; byte < 256; byte++) {
+                uint32_t value = byte;
+                for (int bit = 0; bit < 8; bit++)
+                    value = (value & 1) ? 0xEDB88320u ^ (value >> 1) : value >> 1;
+                entries[byte] = value;
+            }
+            return entries;
+        }();
+
+        crc = ~crc;
+        for (size_t index = 0; index < length; index++)
+            crc = table[(crc ^ data[index]) & 0xFF] ^ (crc >> 8);
+        return ~crc;
+    }
+
+    // The Adler-32 ending a zlib stream
+    uint32_t adler32(const string& data) {
+        uint32_t low = 1, high = 0;
+        for (unsigned char byte : data) {
+            low = (low + byte) % 65521;
+            high = (high + low) % 65521;
+        }
+        return (high << 16) | low;
+    }
+
+    // Append a number as four bytes, most significant first
+    void appendBigEndian(string& bytes, uint32_t value) {
+        bytes.push_back(static_cast<char>(value >> 24));
+        bytes.push_back(static_cast<char>(value >> 16));
+        bytes.push_back(static_cast<char>(value >> 8));
+        bytes.push_back(static_cast<char>(value));
+    }
+
+    // Append a PNG chunk, the checksum covers the type and the data
+    void appendChunk(string& bytes, const char* type, const string& data) {
+        appendBigEndian(bytes, static_cast<uint32_t>(data.size()));
+        size_t start = bytes.size();
+        bytes.append(type, 4);
+        bytes += data;
+        appendBigEndian(bytes, crc32(reinterpret_cast<const unsigned char*>(bytes.data()) + start, 4 + data.size()));
+    }
+
+    /**
+     * @brief Writes the bits of a deflate stream, least significant first.
+     */
+    struct BitWriter {
+        string& bytes;      ///< where the stream is written
+        uint32_t bits = 0;  ///< bits not written yet
+        int count = 0;      ///< number of bits not written yet
+
+        // Append bits, least significant first
+        void put(uint32_t value, int length) {
+            bits |= value << count;
+            count += length;
+            while (count >= 8) {
+                bytes.push_back(static_cast<char>(bits & 0xFF));
+                bits >>= 8;
+                count -= 8;
+            }
+        }
+
+        // Append a Huffman code, which is written most significant first
+        void putCode(uint32_t code, int length) {
+            uint32_t reversed = 0;
+            for (int bit = 0; bit < length; bit++)
+                reversed |= ((code >> bit) & 1) << (length - 1 - bit);
+            put(reversed, length);
+        }
+
+        // Append a literal, length or end symbol with the fixed Huffman codes
+        void putSymbol(int symbol) {
+            if (symbol < 144)
+                putCode(0x30 + symbol, 8);
+            else if (symbol < 256)
+                putCode(0x190 + symbol - 144, 9);
+            else if (symbol < 280)
+                putCode(symbol - 256, 7);
+            else
+                putCode(0xC0 + symbol - 280, 8);
+        }
+
+        // Write the last bits, padded to a byte
+        void finish() {
+            if (count > 0)
+                bytes.push_back(static_cast<char>(bits & 0xFF));
+            bits = 0;
+            count = 0;
+        }
+    };
+
+    // Compress as one fixed Huffman block, repeated bytes are back references to the byte before
+    void deflateRuns(const string& data, string& bytes) {
+        BitWriter writer{bytes};
+        writer.put(1, 1);  // last block
+        writer.put(1, 2);  // fixed Huffman codes
+
+        size_t position = 0;
+        while (position < data.size()) {
+            size_t run = 0;
+            if (position > 0) {
+                while (run < MAX_RUN && position + run < data.size() && data[position + run] == data[position - 1])
+                    run++;
+            }
+
+            if (run < MIN_RUN) {
+                writer.putSymbol(static_cast<unsigned char>(data[position]));
+                position++;
+                continue;
+            }
+
+            int code = 28;
+            while (LENGTH_BASE[code] > static_cast<int>(run))
+                code--;
+            writer.putSymbol(257 + code);
+            writer.put(static_cast<uint32_t>(run - LENGTH_BASE[code]), LENGTH_EXTRA[code]);
+            writer.putCode(0, 5);  // distance 1
+            position += run;
+        }
+        writer.putSymbol(256);
+        writer.finish();
+    }
+}
+
+// Check the directory and start the threads
+ImageExporter::ImageExporter(const string& directory, int every, ImageFormat format, int threadCount, int queueSize)
+        : directory(directory), every(every > 1 ? every : 1), format(format),
+          slots(queueSize > 1 ? queueSize : 1) {
+    DIR* dir = opendir(directory.c_str());
+    if (dir == nullptr) {
+        cout << "Could not open the export directory " << directory << endl;
+        throw ios_base::failure("Could not open the export directory");
+    }
+    closedir(dir);
+
+    for (int slot = static_cast<int>(slots.size()) - 1; slot >= 0; slot--)
+        freeSlots.push_back(slot);
+    for (int worker = 0; worker < (threadCount > 1 ? threadCount : 1); worker++)
+        workers.emplace_back(&ImageExporter::workerLoop, this);
+}
+
+// Write what is queued, failures are only reported by finish
+ImageExporter::~ImageExporter() {
+    try {
+        finish();
+    }
+    catch (ios_base::failure&) {}
+}
+
+// Copy the cells into a free slot, or drop the generation
+void ImageExporter::offer(const GenerationView& generation) {
+    if (generation.getGeneration() < nextGeneration)
+        return;
+    nextGeneration = (generation.getGeneration() / every + 1) * every;
+
+    int slot;
+    {
+        lock_guard<mutex> lock(queueMutex);
+        if (freeSlots.empty()) {
+            stats.dropped++;
+            return;
+        }
+        slot = freeSlots.back();
+        freeSlots.pop_back();
+    }
+
+    // the slot belongs to this thread until it is queued
+    generation.takeSnapshot(slots[slot]);
+    {
+        lock_guard<mutex> lock(queueMutex);
+        queuedSlots.push_back(slot);
+    }
+    queued.notify_one();
+}
+
+// Let the threads drain the queue, then report the first failure
+const ExportStats& ImageExporter::finish() {
+    {
+        lock_guard<mutex> lock(queueMutex);
+        stopping = true;
+    }
+    queued.notify_all();
+    for (auto & worker : workers)
+        worker.join();
+    workers.clear();
+
+    if (failure) {
+        exception_ptr firstFailure = failure;
+        failure = nullptr;
+        try {
+            rethrow_exception(firstFailure);
+        }
+        catch (ios_base::failure& e) {
+            cout << e.what() << endl;
+            throw;
+        }
+    }
+    return stats;
+}
+
+// Take the oldest queued slot until the queue is drained and stopped
+void ImageExporter::workerLoop() {
+    string bytes;
+    unique_lock<mutex> lock(queueMutex);
+    while (true) {
+        queued.wait(lock, [this] { return stopping || !queuedSlots.empty(); });
+        if (queuedSlots.empty())
+            return;
+        int slot = queuedSlots.front();
+        queuedSlots.pop_front();
+        lock.unlock();
+
+        auto start = chrono::steady_clock::now();
+        bool written = false;
+        exception_ptr writeFailure;
+        try {
+            writeImage(slots[slot], bytes);
+            written = true;
+        }
+        catch (...) {
+            writeFailure = current_exception();
+        }
+        double seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+
+        lock.lock();
+        freeSlots.push_back(slot);
+        if (written)
+            stats.written++;
+        else if (!failure)
+            failure = writeFailure;
+        stats.encodeSeconds += seconds;
+    }
+}
+
+// Encode the frame and write it to a file named after its generation
+void ImageExporter::writeImage(const Frame& frame, string& bytes) {
+    if (format == ImageFormat::PNG)
+        encodePng(frame, bytes);
+    else
+        encodePpm(frame, bytes);
+
+    char name[32];
+    snprintf(name, sizeof(name), "/generation_%06d.%s", frame.generation,
+             format == ImageFormat::PNG ? "png" : "ppm");
+    string fileName = directory + name;
+
+    ofstream file(fileName, ios::binary);
+    file.write(bytes.data(), static_cast<streamsize>(bytes.size()));
+    if (!file.good())
+        throw ios_base::failure("Could not write " + fileName);
+}
+
+// Header, then three bytes per cell, rim excluded
+void ImageExporter::encodePpm(const Frame& frame, string& bytes) {
+    int width = frame.width - 2, height = frame.height - 2;
+    bytes = "P6\n" + to_string(width) + " " + to_string(height) + "\n255\n";
+    bytes.reserve(bytes.size() + static_cast<size_t>(width) * height * 3);
+    for (int row = 1; row <= height; row++) {
+        for (int column = 1; column <= width; column++) {
+            const unsigned char* rgb = COLOR_RGB[paletteIndex(frame.colors[frame.index(column, row)])];
+            bytes.append(reinterpret_cast<const char*>(rgb), 3);
+        }
+    }
+}
+
+// Signature, header, palette, the compressed rows and the end
+void ImageExporter::encodePng(const Frame& frame, string& bytes) {
+    int width = frame.width - 2, height = frame.height - 2;
+    static const char SIGNATURE[8] = {'\x89', 'P', 'N', 'G', '\r', '\n', '\x1A', '\n'};
+    bytes.assign(SIGNATURE, sizeof(SIGNATURE));
+
+    string header;
+    appendBigEndian(header, static_cast<uint32_t>(width));
+    appendBigEndian(header, static_cast<uint32_t>(height));
+    header += string("\x08\x03\x00\x00\x00", 5);  // 8 bit palette indexes, no interlace
+    appendChunk(bytes, "IHDR", header);
+
+    string palette(reinterpret_cast<const char*>(COLOR_RGB), sizeof(COLOR_RGB));
+    appendChunk(bytes, "PLTE", palette);
+
+    // each row starts with filter type 0, no filter
+    string rows;
+    rows.reserve(static_cast<size_t>(width + 1) * height);
+    for (int row = 1; row <= height; row++) {
+        rows.push_back('\0');
+        for (int column = 1; column <= width; column++)
+            rows.push_back(static_cast<char>(paletteIndex(frame.colors[frame.index(column, row)])));
+    }
+
+    string compressed("\x78\x01", 2);  // zlib header, 32K window
+    deflateRuns(rows, compressed);
+    appendBigEndian(compressed, adler32(rows));
+    appendChunk(bytes, "IDAT", compressed);
+    appendChunk(bytes, "IEND", "");
+}
@@ -6,46 +6,187 @@
 */
 
 #include "ScreenPrinter.h"
+#include "Autotuner.h"
+#include "EnsembleRunner.h"
+#include "FrameStreamer.h"
+#include "ImageExporter.h"
+#include "SlabSimulation.h"
+#include <chrono>
+#include <cstdio>
 #include <iostream>
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include <algorithm>
 
 using namespace std;
 
+/// @brief Where cout writes when it has not been redirected.
+static streambuf* const STANDARD_OUTPUT = cout.rdbuf();
+
+/// @brief Bytes reserved per cell of a frame, enough for a cursor move, two colors and the value.
+const size_t FRAME_BYTES_PER_CELL = 32;
+
 // Prints the population to screen
 void ScreenPrinter::printBoard(Population& population) {
+    Frame frame;
+    population.takeSnapshot(frame);
+    printBoard(frame);
+}
+
+// Prints what differs from the screen, as cells or downsampled
+void ScreenPrinter::printBoard(const Frame& frame) {
+    auto start = chrono::steady_clock::now();
+
+    // the terminal shows the frame once it is completely written
+    if (synchronizedOutput)
+        output.beginSynchronizedUpdate();
+
+    // compose the frame in the buffer, which keeps its memory between frames
+    output.showCursor(false);	// hide cursor
+
+    // cout may have moved the cursor or changed the color since the last frame
+    output.forgetState();
 
-    // TODO change to dimension
-    int windowHeight = WORLD_DIMENSIONS.HEIGHT + 1;
-    int windowWidth = WORLD_DIMENSIONS.WIDTH + 1;
+    if (renderer != nullptr)
+        composeDownsampled(frame);
+    else
+        composeCells(frame);
 
-    terminal.showCursor(false);	// hide cursor
+    if (synchronizedOutput)
+        output.endSynchronizedUpdate();
 
-    // Each row
-    for (int row = 0; row <= windowHeight; row++) {
-        // Each column
-        for (int column = 0; column <= windowWidth; column++) {
-            // Get cell att position [column,row]
-            Cell cell = population.getCellAtPosition(Point{column, row});
+    renderStats.bytes += output.size();
+    auto writeStart = chrono::steady_clock::now();
+    renderStats.writeCalls += writeOutput();
+    auto end = chrono::steady_clock::now();
+    renderStats.frames++;
+    renderStats.renderSeconds += chrono::duration<double>(end - start).count();
 
-            // set cursor to relevant point
-            terminal.setCursor(column, row);
+    // a write blocks when the terminal has not read the previous frames, give it as long again to catch up
+    chrono::duration<double> writeSeconds = end - writeStart;
+    renderStats.writeSeconds += writeSeconds.count();
+    if (writeSeconds.count() > SLOW_WRITE_SECONDS)
+        terminalBusyUntil = end + chrono::duration_cast<chrono::steady_clock::duration>(writeSeconds);
+    frameShown = true;
+}
+
+// Compose the cells of a snapshot that differ from what is on the screen
+void ScreenPrinter::composeCells(const Frame& frame) {
+    output.reserve(static_cast<size_t>(frame.width) * frame.height * FRAME_BYTES_PER_CELL);
 
-            // If cell isn't a rim cell
-            if (!cell.isRimCell()) {
+    // every cell is printed when the screen does not hold a frame of the same size
+    bool printAll = !frameShown || shownFrame.width != frame.width || shownFrame.height != frame.height;
 
-                // Get cell color
-                COLOR cellColor = cell.getColor();
+    // Each row, except the rim
+    for (int row = 1; row < frame.height - 1; row++) {
+        // Each column, except the rim
+        for (int column = 1; column < frame.width - 1; column++) {
+            size_t index = frame.index(column, row);
+            if (!printAll && frame.values[index] == shownFrame.values[index]
+                && frame.colors[index] == shownFrame.colors[index])
+                continue;
 
-                // Change terminal color
-                terminal.pushColor(TerminalColor(cellColor, STATE_COLORS.DEAD));
+            // the buffer only moves the cursor at the start of each run of changed cells
+            output.setCursor(column, row);
 
-                // Write cell to screen
-                cout << cell.getCellValue();
+            // the buffer only changes the color when it differs from the previous cell
+            output.setColor(TerminalColor(frame.colors[index], STATE_COLORS.DEAD));
 
-                // Reset color
-                terminal.popColor();
-            }
+            // Write cell to screen
+            output.put(frame.values[index]);
         }
     }
+
+    // Reset color, and leave the cursor below the board, as after printing every cell
+    output.resetColor();
+    output.setCursor(frame.width - 1, frame.height - 1);
+
+    shownFrame = frame;
+}
+
+// Compose the characters of the viewport that differ from what is on the screen
+void ScreenPrinter::composeDownsampled(const Frame& frame) {
+    const vector<uint32_t>& glyphs = renderer->render(frame);
+    int columns = renderer->getColumns();
+    output.reserve(glyphs.size() * FRAME_BYTES_PER_CELL);
+
+    // every character is printed when the screen does not hold the characters of the viewport
+    bool printAll = !frameShown || shownGlyphs.size() != glyphs.size();
+
+    // the dots are alive cells
+    output.setColor(TerminalColor(STATE_COLORS.LIVING, STATE_COLORS.DEAD));
+    for (size_t index = 0; index < glyphs.size(); index++) {
+        if (!printAll && glyphs[index] == shownGlyphs[index])
+            continue;
+
+        output.setCursor(static_cast<unsigned int>(index % columns) + 1, static_cast<unsigned int>(index / columns) + 1);
+        output.putGlyph(glyphs[index]);
+    }
+
+    // Reset color, and leave the cursor below the viewport
+    output.resetColor();
+    output.setCursor(1, renderer->getRows() + 1);
+
+    shownGlyphs = glyphs;
+}
+
+// Use the size of the terminal, less a row for what is printed after the frames
+void ScreenPrinter::setDownsampling(DownsampleMode mode, const Viewport& viewport) {
+    delete renderer;
+    renderer = nullptr;
+    frameShown = false;
+    if (mode == DownsampleMode::CELLS)
+        return;
+
+    Dimensions terminalSize = getTerminalSize();
+    renderer = new DownsampledRenderer(mode, viewport, terminalSize.WIDTH, max(terminalSize.HEIGHT - 1, 1));
+}
+
+// Switch to or from the alternate screen at once
+void ScreenPrinter::setSynchronizedOutput(bool on) {
+    if (on == synchronizedOutput)
+        return;
+
+    synchronizedOutput = on;
+    output.useAlternateScreen(on);
+    if (!on)
+        output.showCursor(true);
+    writeOutput();
+    terminalBusyUntil = chrono::steady_clock::time_point();
+    frameShown = false;
+}
+
+// Only with synchronized output, before the slow write has been caught up
+bool ScreenPrinter::isTerminalBehind() const {
+    return synchronizedOutput && chrono::steady_clock::now() < terminalBusyUntil;
+}
+
+// Ask the terminal for its size, 80x24 when there is no terminal
+Dimensions ScreenPrinter::getTerminalSize() {
+    winsize size{};
+    if (ioctl(STDOUT_FILENO, TIOCGWINSZ, &size) == 0 && size.ws_col > 0 && size.ws_row > 0)
+        return Dimensions{size.ws_col, size.ws_row};
+    return Dimensions{80, 24};
+}
+
+// Do not leave the terminal on the alternate screen, the renderer is owned by the printer
+ScreenPrinter::~ScreenPrinter() {
+    setSynchronizedOutput(false);
+    delete renderer;
+}
+
+// Write the composed frame with one call, or through cout when it is redirected
+int ScreenPrinter::writeOutput() {
+    if (cout.rdbuf() != STANDARD_OUTPUT) {
+        cout.write(output.data(), output.size());
+        output.clear();
+        return 1;
+    }
+
+    // what is printed through cout must come before the frame
+    cout.flush();
+    fflush(stdout);
+    return output.flush(STDOUT_FILENO);
 }
 
 // Prints the help screen
@@ -62,7 +203,51 @@ void ScreenPrinter::printHelpScreen() {
          << "-g <Amount of generations> [default=500]" << endl << endl
          << "-s <World dimensions> [default=80x24]" << endl << endl
          << "-f <Filename for initial state> [default=random state]" << endl
-         << "\tfilename overrides -s argument" << endl;
+         << "\tfilename overrides -s argument" << endl << endl
+         << "-sd <Seed of the random state> [default=from the clock]" << endl << endl
+         << "-dn <Share of alive cells in the random state, 0 to 1> [default=0.5]" << endl << endl
+         << "-rm <Filename for rule map> [default=no rule map]" << endl
+         << "\tone area per line: <column> <row> <width>x<height> <even rule> [odd rule]" << endl << endl
+         << "-pd <Directory with rule plugins> [default=no plugins]" << endl
+         << "\tloaded plugins are selected by name with -er, -or and -rm" << endl << endl
+         << "-gs <Generations per sweep, 1 or 2> [default=1]" << endl
+         << "\t2 advances two generations per sweep, when the rules allows it" << endl << endl
+         << "-t <Number of threads> [default=1]" << endl << endl
+         << "-sc <Scheduling of tiles on threads> [default=bands]" << endl
+         << "\tbands" << endl
+         << "\tstealing" << endl << endl
+         << "-at <Choose threads and tile size by timing them, on or off> [default=off]" << endl
+         << "\tthe choice is cached per rules, world size and CPU model in " << AUTOTUNE_CACHE_FILE << endl << endl
+         << "-pt <Pin threads to NUMA nodes, on or off> [default=off]" << endl << endl
+         << "-pr <Number of worker processes> [default=1]" << endl
+         << "\tsplits the world into one slab per process, each building only its own rows" << endl
+         << "\tonly the last generation is shown, none with -hl on" << endl << endl
+         << "-ds <How the cells are shown> [default=cells]" << endl
+         << "\tcells" << endl
+         << "\thalf, 1x2 dots per character" << endl
+         << "\tbraille, 2x4 dots per character" << endl << endl
+         << "-vp <First column and row shown with half or braille> [default=0x0]" << endl << endl
+         << "-zm <Width and height in cells of each dot> [default=1]" << endl << endl
+         << "-so <Show frames on the alternate screen with synchronized updates, on or off> [default=off]" << endl
+         << "\tframes are skipped while the terminal is behind" << endl << endl
+         << "-ex <Directory the generations are exported to as images> [default=no export]" << endl
+         << "\twritten on threads of their own, dropped when " << EXPORT_QUEUE_SIZE << " are waiting" << endl << endl
+         << "-ee <Generations between two exported images> [default=1]" << endl << endl
+         << "-ef <Format of the exported images> [default=ppm]" << endl
+         << "\tppm" << endl
+         << "\tpng" << endl << endl
+         << "-st <File or named pipe the frames are streamed to, - for standard output> [default=printed]" << endl
+         << "\traw pixels after a " << STREAM_HEADER_SIZE << " byte header, frames are skipped while the reader is behind" << endl << endl
+         << "-sf <Pixel format of the streamed frames> [default=rgb]" << endl
+         << "\trgb" << endl
+         << "\tpalette" << endl << endl
+         << "-fps <Frames printed per second> [default=as fast as possible]" << endl << endl
+         << "-gps <Generations calculated per second> [default=as fast as possible]" << endl
+         << "\tpaced independently of -fps, generations between frames are not printed" << endl << endl
+         << "-hl <Run without presenting the world, on or off> [default=off]" << endl
+         << "\tprints generations and cells per second, checksum and population at the end" << endl << endl
+         << "-en <Number of seeds> [default=off]" << endl
+         << "\tsimulates one random world per seed from -sd without showing it, prints one record per seed" << endl;
 }
 
 // print message, som information to the user (i.e. error messages)
@@ -70,8 +255,89 @@ void ScreenPrinter::printMessage(const string& message) {
     cout << message << endl;
 }
 
+// print one line of work stealing stats per thread
+void ScreenPrinter::printWorkerStats(const vector<WorkerStats>& stats) {
+    for (size_t worker = 0; worker < stats.size(); worker++) {
+        cout << "Thread " << worker << ": " << stats[worker].tasks << " tiles, "
+             << stats[worker].steals << " stolen, "
+             << stats[worker].idleSeconds * 1000.0 << " ms idle" << endl;
+    }
+}
+
+// print one line per slab worker process, and the total
+void ScreenPrinter::printSlabStats(const vector<SlabStats>& stats) {
+    unsigned long alive = 0;
+    for (size_t slab = 0; slab < stats.size(); slab++) {
+        cout << "Slab " << slab << " (rows " << stats[slab].firstRow << "-" << stats[slab].lastRow << "): "
+             << stats[slab].computeSeconds * 1000.0 << " ms computing, "
+             << stats[slab].haloWaitSeconds * 1000.0 << " ms waiting for halos, "
+             << stats[slab].aliveCells << " alive" << endl;
+        alive += stats[slab].aliveCells;
+    }
+    cout << "Total: " << stats.size() << " processes, " << alive << " alive" << endl;
+}
+
+// print the ensemble as comma separated values, one line per seed
+void ScreenPrinter::printEnsembleResults(const vector<EnsembleResult>& results) {
+    cout << "seed,stabilisation_generation,final_population,period" << endl;
+    for (auto & result : results)
+        cout << result.seed << "," << result.stabilisationGeneration << ","
+             << result.finalPopulation << "," << result.period << endl;
+}
+
+// print the rates and the last generation
+void ScreenPrinter::printHeadlessStats(const HeadlessStats& stats) {
+    double seconds = stats.seconds > 0.0 ? stats.seconds : 1e-9;
+    cout << "Generations: " << stats.generations << " in " << stats.seconds << " s" << endl
+         << "Generations per second: " << stats.generations / seconds << endl
+         << "Cells per second: " << stats.cellUpdates / seconds << endl
+         << "Checksum: " << hex << stats.checksum << dec << endl
+         << "Population: " << stats.population << endl;
+}
+
+// print the achieved rates
+void ScreenPrinter::printPacingStats(const PacingStats& stats) {
+    cout << "Achieved " << stats.framesPerSecond << " frames per second and "
+         << stats.generationsPerSecond << " generations per second" << endl;
+}
+
+// print the images and the time per image
+void ScreenPrinter::printExportStats(const ExportStats& stats) {
+    unsigned long written = stats.written > 0 ? stats.written : 1;
+    cout << "Exported " << stats.written << " images, " << stats.dropped << " dropped with a full queue, "
+         << stats.encodeSeconds * 1000.0 / written << " ms per image" << endl;
+}
+
+// print the frames and how they were written
+void ScreenPrinter::printStreamStats(const StreamStats& stats) {
+    cout << "Streamed " << stats.frames << " frames: " << stats.bytes << " bytes in " << stats.writeCalls
+         << (stats.spliced ? " vmsplice calls" : " writev calls")
+         << (stats.closed ? ", the reader closed the stream" : "") << endl;
+}
+
+// print the averages per frame
+void ScreenPrinter::printRenderStats(const RenderStats& stats) {
+    unsigned long frames = stats.frames > 0 ? stats.frames : 1;
+    cout << "Rendered " << stats.frames << " frames: "
+         << stats.renderSeconds * 1000.0 / frames << " ms, "
+         << stats.bytes / frames << " bytes and "
+         << static_cast<double>(stats.writeCalls) / frames << " write calls per frame, "
+         << stats.writeSeconds * 1000.0 / frames << " ms writing" << endl;
+}
+
+// print one line of estimated cell bandwidth per NUMA node
+void ScreenPrinter::printNodeStats(const vector<NodeStats>& stats) {
+    for (auto & node : stats) {
+        double megabytes = node.bytes / 1e6;
+        cout << "Node " << node.node << ": " << node.threads << " threads, "
+             << megabytes << " MB of cells (estimated), "
+             << (node.busySeconds > 0.0 ? megabytes / node.busySeconds : 0.0) << " estimated MB/s" << endl;
+    }
+}
+
 // Clears the terminal
 void ScreenPrinter::clearScreen() {
 
     terminal.clear();
+    frameShown = false;
 }
\ No newline at end of file
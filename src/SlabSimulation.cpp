@@ -0,0 +1,313 @@
+/*
+ * Filename    SlabSimulation.cpp
+ * Author      Group 11
+ * Date        October 2026
+ * Version     0.3
+*/
+
+#include "SlabSimulation.h"
+#include <cerrno>
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <new>
+#include "GoL_Rules/RuleFactory.h"
+#include "Support/FileLoader.h"
+
+#ifndef _WIN32
+#include <csignal>
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+/// @brief Alignment of the parts of the shared memory.
+const size_t SHARED_ALIGNMENT = 64;
+
+// Round up to the alignment of the shared memory.
+static size_t alignShared(size_t size) {
+    return (size + SHARED_ALIGNMENT - 1) / SHARED_ALIGNMENT * SHARED_ALIGNMENT;
+}
+
+#ifndef _WIN32
+// Write every byte, a pipe may take them in parts.
+static bool writeAll(int fd, const void* data, size_t size) {
+    const char* bytes = static_cast<const char*>(data);
+    while (size > 0) {
+        ssize_t written = write(fd, bytes, size);
+        if (written < 0 && errno == EINTR)
+            continue;
+        if (written <= 0)
+            return false;
+        bytes += written;
+        size -= static_cast<size_t>(written);
+    }
+    return true;
+}
+
+// Read every byte, false if the pipe is closed before.
+static bool readAll(int fd, void* data, size_t size) {
+    char* bytes = static_cast<char*>(data);
+    while (size > 0) {
+        ssize_t result = read(fd, bytes, size);
+        if (result < 0 && errno == EINTR)
+            continue;
+        if (result <= 0)
+            return false;
+        bytes += result;
+        size -= static_cast<size_t>(result);
+    }
+    return true;
+}
+#endif
+
+// Every rule of the world, with or without a rule map, must have a step table.
+bool SlabSimulation::hasLocalRules() {
+    vector<string> ruleNames{evenRuleName, oddRuleName.empty() ? evenRuleName : oddRuleName};
+    if (!ruleMapFileName.empty()) {
+        RuleMap ruleMap;
+        ruleMap.loadFromFile(ruleMapFileName);
+        for (auto & area : ruleMap.getAreas()) {
+            ruleNames.push_back(area.evenRuleName);
+            ruleNames.push_back(area.oddRuleName);
+        }
+    }
+
+    map<Point, Cell> noCells;
+    vector<unsigned char> table;
+    for (auto & ruleName : ruleNames) {
+        unique_ptr<RuleOfExistence> rule(RuleFactory::getInstance().createAndReturnRule(noCells, ruleName));
+        if (!rule->getStepTable(table))
+            return false;
+    }
+    return true;
+}
+
+// Split the rows into one slab for each process.
+void SlabSimulation::buildSlabs(int height) {
+    // never more slabs than rows, every slab needs a row of its own
+    int slabs = (processes < 1) ? 1 : processes;
+    if (slabs > height)
+        slabs = height;
+
+    slabStarts.clear();
+    for (int slab = 0; slab <= slabs; slab++)
+        slabStarts.push_back(static_cast<int>(static_cast<long long>(height) * slab / slabs));
+}
+
+// Copy a row of cells out of the population.
+void SlabSimulation::copyRow(Population& population, int row, vector<Cell>& cells) {
+    for (size_t column = 0; column < cells.size(); column++)
+        cells[column] = population.getCellAtPosition(Point{static_cast<int>(column), row});
+}
+
+// Copy a row of cells into the population.
+void SlabSimulation::pasteRow(Population& population, int row, const vector<Cell>& cells) {
+    for (size_t column = 0; column < cells.size(); column++)
+        population.getCellAtPosition(Point{static_cast<int>(column), row}) = cells[column];
+}
+
+// Build the rows of one slab, calculate its generations and exchange the rows next to the other slabs.
+void SlabSimulation::runSlab(int slab, int generations, vector<HaloRing>& downRings,
+                             vector<HaloRing>& upRings, int pictureFd, SlabStats& slabStats) {
+#ifndef _WIN32
+    int firstRow = slabStarts[slab];
+    int lastRow = slabStarts[slab + 1] - 1;
+    bool hasAbove = slab > 0;
+    bool hasBelow = slab + 2 < static_cast<int>(slabStarts.size());
+
+    // only the rows of the slab and the halo around them are built
+    Population population;
+    population.setWorld(world);
+    population.setTileSize(tileSize);
+    population.setRows(firstRow, lastRow);
+    population.initiatePopulation(evenRuleName, oddRuleName, ruleMapFileName);
+    size_t tiles = population.getRuleTiles().size();
+    int width = population.getWorldDimensions().WIDTH + 2;
+
+    vector<Cell> row(width);
+    double waited = 0.0;
+    chrono::steady_clock::time_point start = chrono::steady_clock::now();
+    for (int generation = 0; generation < generations; generation++) {
+        population.updateTiles(0, tiles);
+
+        // send the edges before receiving, so neighbours never wait on each other
+        if (hasAbove) {
+            copyRow(population, firstRow, row);
+            upRings[slab - 1].push(row.data());
+        }
+        if (hasBelow) {
+            copyRow(population, lastRow, row);
+            downRings[slab].push(row.data());
+        }
+        if (hasAbove) {
+            waited += downRings[slab - 1].pop(row.data());
+            pasteRow(population, firstRow - 1, row);
+        }
+        if (hasBelow) {
+            waited += upRings[slab].pop(row.data());
+            pasteRow(population, lastRow + 1, row);
+        }
+
+        population.executeRulesForTiles(0, tiles);
+    }
+    double seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+
+    // the shown state of the rows, written row by row as the frame holds them
+    unsigned long alive = 0;
+    vector<char> values(width);
+    vector<COLOR> colors(width);
+    vector<unsigned char> aliveRow(width);
+    for (int y = firstRow; y <= lastRow; y++) {
+        for (int x = 0; x < width; x++) {
+            Cell& cell = population.getCellAtPosition(Point{x, y});
+            values[x] = cell.getCellValue();
+            colors[x] = cell.getColor();
+            aliveRow[x] = cell.isAlive() ? 1 : 0;
+            alive += aliveRow[x];
+        }
+        if (pictureFd >= 0 && !(writeAll(pictureFd, values.data(), values.size())
+                                && writeAll(pictureFd, colors.data(), colors.size() * sizeof(COLOR))
+                                && writeAll(pictureFd, aliveRow.data(), aliveRow.size())))
+            throw ios_base::failure("Could not write the rows of the slab");
+    }
+    slabStats = SlabStats{firstRow, lastRow, seconds - waited, waited, alive};
+#endif
+}
+
+// Fork a worker for each slab, wait for them and collect the stats, and the rows if asked for.
+void SlabSimulation::run(int generations, Frame* frame) {
+#ifdef _WIN32
+    cout << "Worker processes are not supported on this platform" << endl;
+    throw ios_base::failure("Worker processes are not supported");
+#else
+    if (!hasLocalRules()) {
+        cout << "The rules can not be split into slabs, they need more than the neighbouring cells" << endl;
+        throw ios_base::failure("Rules can not be split into slabs");
+    }
+
+    // only the size is needed, a file is not read past its first row
+    Dimensions dimensions = world.dimensions;
+    if (!world.fileName.empty()) {
+        map<Point, Cell> firstRow;
+        FileLoader().loadPopulationFromFile(firstRow, world.fileName, dimensions, 0, 0);
+    }
+    size_t width = dimensions.WIDTH + 2;
+    int height = dimensions.HEIGHT + 2;
+    buildSlabs(height);
+    int slabs = static_cast<int>(slabStarts.size()) - 1;
+
+    // rings between each pair of slabs, then the stats and the abort flag
+    size_t ringSize = alignShared(HaloRing::getSize(width, HALO_RING_SLOTS));
+    size_t ringsSize = ringSize * 2 * (slabs - 1);
+    size_t statsSize = alignShared(sizeof(SlabStats) * slabs);
+    size_t size = ringsSize + statsSize + sizeof(atomic<int>);
+
+    void* memory = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+    if (memory == MAP_FAILED) {
+        cout << "Could not map memory shared by the slabs" << endl;
+        throw ios_base::failure("Could not map shared memory");
+    }
+    char* shared = static_cast<char*>(memory);
+    SlabStats* sharedStats = reinterpret_cast<SlabStats*>(shared + ringsSize);
+    atomic<int>* aborted = new (shared + ringsSize + statsSize) atomic<int>(0);
+
+    vector<HaloRing> downRings, upRings;
+    for (int boundary = 0; boundary < slabs - 1; boundary++) {
+        downRings.emplace_back(shared + ringSize * 2 * boundary, width, HALO_RING_SLOTS, aborted);
+        upRings.emplace_back(shared + ringSize * (2 * boundary + 1), width, HALO_RING_SLOTS, aborted);
+    }
+
+    // one pipe per slab for the rows of the last generation
+    vector<int> pictureFds(slabs, -1), writeFds(slabs, -1);
+    bool failed = false;
+    if (frame != nullptr) {
+        // a worker whose reader has given up gets EPIPE, instead of ending
+        signal(SIGPIPE, SIG_IGN);
+        for (int slab = 0; slab < slabs && !failed; slab++) {
+            int fds[2];
+            failed = pipe(fds) != 0;
+            if (!failed) {
+                pictureFds[slab] = fds[0];
+                writeFds[slab] = fds[1];
+            }
+        }
+    }
+
+    // the workers build their own slabs and leave without returning
+    cout.flush();
+    vector<pid_t> workers;
+    for (int slab = 0; slab < slabs && !failed; slab++) {
+        pid_t pid = fork();
+        if (pid == 0) {
+            for (int other = 0; other < slabs; other++) {
+                if (pictureFds[other] >= 0)
+                    close(pictureFds[other]);
+                if (other != slab && writeFds[other] >= 0)
+                    close(writeFds[other]);
+            }
+            try {
+                runSlab(slab, generations, downRings, upRings, writeFds[slab], sharedStats[slab]);
+                _exit(0);
+            }
+            catch (...) {
+                aborted->store(1);
+                _exit(1);
+            }
+        }
+        if (pid < 0) {
+            aborted->store(1);
+            failed = true;
+            break;
+        }
+        workers.push_back(pid);
+    }
+    for (auto & fd : writeFds) {
+        if (fd >= 0)
+            close(fd);
+    }
+
+    // the rows are read slab after slab, each worker waits until its turn
+    if (frame != nullptr && !failed) {
+        frame->generation = generations;
+        frame->width = static_cast<int>(width);
+        frame->height = height;
+        size_t cells = width * static_cast<size_t>(height);
+        frame->values.resize(cells);
+        frame->colors.resize(cells);
+        frame->alive.resize(cells);
+        for (int slab = 0; slab < slabs && !failed; slab++) {
+            for (int row = slabStarts[slab]; row < slabStarts[slab + 1] && !failed; row++) {
+                size_t index = frame->index(0, row);
+                failed = !(readAll(pictureFds[slab], frame->values.data() + index, width)
+                           && readAll(pictureFds[slab], frame->colors.data() + index, width * sizeof(COLOR))
+                           && readAll(pictureFds[slab], frame->alive.data() + index, width));
+            }
+        }
+        if (failed)
+            aborted->store(1);
+    }
+    for (auto & fd : pictureFds) {
+        if (fd >= 0)
+            close(fd);
+    }
+
+    failed = failed || static_cast<int>(workers.size()) != slabs;
+    for (auto & worker : workers) {
+        int status = 0;
+        if (waitpid(worker, &status, 0) < 0 || !WIFEXITED(status) || WEXITSTATUS(status) != 0) {
+            aborted->store(1);
+            failed = true;
+        }
+    }
+
+    if (!failed)
+        stats.assign(sharedStats, sharedStats + slabs);
+    munmap(memory, size);
+
+    if (failed) {
+        cout << "A slab worker process failed" << endl;
+        throw ios_base::failure("A slab worker process failed");
+    }
+#endif
+}
@@ -0,0 +1,110 @@
+/*
+ * Filename    CpuTopology.cpp
+ * Author      Group 11
+ * Date        October 2026
+ * Version     0.3
+*/
+
+#include "Support/CpuTopology.h"
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <thread>
+
+/// @brief Highest node number looked for.
+const int MAX_NUMA_NODES = 64;
+
+// Read the CPUs of each node, one node with every CPU if the kernel does not tell.
+CpuTopology::CpuTopology() {
+    for (int node = 0; node < MAX_NUMA_NODES; node++) {
+        ifstream file("/sys/devices/system/node/node" + to_string(node) + "/cpulist");
+        string list;
+        if (!file || !getline(file, list))
+            continue;
+
+        // nodes with memory only have no CPUs to place workers on
+        vector<int> nodeCpus = parseCpuList(list);
+        if (!nodeCpus.empty()) {
+            nodes.push_back(node);
+            cpus.push_back(nodeCpus);
+        }
+    }
+
+    if (nodes.empty()) {
+        int count = static_cast<int>(thread::hardware_concurrency());
+        nodes.push_back(0);
+        cpus.push_back(vector<int>());
+        for (int cpu = 0; cpu < (count > 0 ? count : 1); cpu++)
+            cpus.back().push_back(cpu);
+    }
+}
+
+// Use the given CPUs for each node.
+CpuTopology::CpuTopology(const vector<vector<int>>& nodeCpus) {
+    for (size_t node = 0; node < nodeCpus.size(); node++) {
+        if (!nodeCpus[node].empty()) {
+            nodes.push_back(static_cast<int>(node));
+            cpus.push_back(nodeCpus[node]);
+        }
+    }
+    if (nodes.empty()) {
+        nodes.push_back(0);
+        cpus.push_back(vector<int>(1, 0));
+    }
+}
+
+// Give each node a contiguous share of the workers, in proportion to its CPUs.
+vector<WorkerPlacement> CpuTopology::placeWorkers(int workers) const {
+    size_t totalCpus = 0;
+    for (auto & nodeCpus : cpus)
+        totalCpus += nodeCpus.size();
+
+    vector<WorkerPlacement> placements;
+    size_t cpusBefore = 0;
+    for (size_t node = 0; node < nodes.size(); node++) {
+        size_t first = workers * cpusBefore / totalCpus;
+        cpusBefore += cpus[node].size();
+        size_t last = workers * cpusBefore / totalCpus;
+
+        for (size_t worker = first; worker < last; worker++)
+            placements.push_back(WorkerPlacement{cpus[node][(worker - first) % cpus[node].size()], nodes[node]});
+    }
+    return placements;
+}
+
+// Read comma separated CPUs and ranges of CPUs.
+vector<int> CpuTopology::parseCpuList(const string& list) {
+    vector<int> result;
+    stringstream stream(list);
+    string part;
+    while (getline(stream, part, ',')) {
+        size_t dash = part.find('-');
+        try {
+            int first = stoi(part.substr(0, dash));
+            int last = (dash == string::npos) ? first : stoi(part.substr(dash + 1));
+            for (int cpu = first; cpu <= last; cpu++)
+                result.push_back(cpu);
+        }
+        catch (logic_error&) {
+            // an empty or broken part holds no CPUs
+        }
+    }
+    return result;
+}
+
+// Take the model name of the first CPU from the kernel.
+string CpuTopology::readCpuModel() {
+    ifstream file("/proc/cpuinfo");
+    string line;
+    while (getline(file, line)) {
+        if (line.compare(0, 10, "model name") != 0)
+            continue;
+        size_t value = line.find(':');
+        if (value == string::npos)
+            continue;
+        value = line.find_first_not_of(" \t", value + 1);
+        if (value != string::npos)
+            return line.substr(value);
+    }
+    return "unknown";
+}
@@ -11,8 +11,9 @@
 #include <iostream>
 #include <Cell_Culture/Population.h>
 
-// Loads the given map with cells read from the file thats pointed to by The global variable fileName
-void FileLoader::loadPopulationFromFile(map<Point, Cell>& cells) {
+// Loads the given map with cells read from the file, and the dimensions of the world
+void FileLoader::loadPopulationFromFile(map<Point, Cell>& cells, const string& fileName,
+                                        Dimensions& dimensions, int firstRow, int lastRow) {
 
     // Open file for reading, if file cant be found throw an exception that
     // prints a error message and throws back to main(closes application)
@@ -34,25 +35,31 @@ void FileLoader::loadPopulationFromFile(map<Point, Cell>& cells) {
 
     // Load the read dimensions
     istringstream iss(worldSize);
-    iss >> WORLD_DIMENSIONS.WIDTH;
+    iss >> dimensions.WIDTH;
     iss.get();
-    iss >> WORLD_DIMENSIONS.HEIGHT;
+    iss >> dimensions.HEIGHT;
     iss.clear();
 
+    if (lastRow < 0 || lastRow > dimensions.HEIGHT + 1)
+        lastRow = dimensions.HEIGHT + 1;
 
-    for (int row = 0; row <= WORLD_DIMENSIONS.HEIGHT + 1; row++) {
+    for (int row = 0; row <= lastRow; row++) {
         // Dont read a line from file for rim rows
-        if (!(row == 0 || row == WORLD_DIMENSIONS.HEIGHT + 1)) {
+        if (!(row == 0 || row == dimensions.HEIGHT + 1)) {
             string populationRow;
             getline(inFile, populationRow);
             iss.str(populationRow);
         }
 
-        for (int column = 0; column <= WORLD_DIMENSIONS.WIDTH + 1; column++) {
+        // rows before the first one are only read past
+        if (row < firstRow)
+            continue;
+
+        for (int column = 0; column <= dimensions.WIDTH + 1; column++) {
             // if cell is a rim cell
             if (column == 0 || row == 0
-                || column == WORLD_DIMENSIONS.WIDTH + 1
-                || row == WORLD_DIMENSIONS.HEIGHT + 1) {
+                || column == dimensions.WIDTH + 1
+                || row == dimensions.HEIGHT + 1) {
 
                 cells[Point{column, row}] = Cell(true); // create a cell with rimCell state set to true
             }
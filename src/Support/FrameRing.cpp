@@ -0,0 +1,52 @@
+/*
+ * Filename    FrameRing.cpp
+ * Author      Group 11
+ * Date        October 2026
+ * Version     0.3
+*/
+
+#include "Support/FrameRing.h"
+
+// Create the slots, at least two so one can be written while one is presented.
+FrameRing::FrameRing(size_t capacity)
+        : slots(capacity < 2 ? 2 : capacity), readCount(0), writeCount(0),
+          droppedFrames(0), skippedFrames(0) {}
+
+// The next slot, if the consumer has released it.
+Frame* FrameRing::beginWrite() {
+    size_t written = writeCount.load(memory_order_relaxed);
+    size_t read = readCount.load(memory_order_acquire);
+
+    if (written - read == slots.size()) {
+        skippedFrames++;
+        return nullptr;
+    }
+    return &slots[written % slots.size()];
+}
+
+// The written frame may now be read by the consumer.
+void FrameRing::publish() {
+    writeCount.store(writeCount.load(memory_order_relaxed) + 1, memory_order_release);
+}
+
+// Skip to the newest published frame.
+const Frame* FrameRing::acquireLatest() {
+    size_t read = readCount.load(memory_order_relaxed);
+    size_t written = writeCount.load(memory_order_acquire);
+
+    if (read == written)
+        return nullptr;
+
+    // release all older frames at once, the producer may reuse them
+    if (written - read > 1) {
+        droppedFrames += written - read - 1;
+        read = written - 1;
+        readCount.store(read, memory_order_release);
+    }
+    return &slots[read % slots.size()];
+}
+
+// The frame is presented, the producer may reuse its slot.
+void FrameRing::release() {
+    readCount.store(readCount.load(memory_order_relaxed) + 1, memory_order_release);
+}
@@ -0,0 +1,74 @@
+/*
+ * Filename    GenerationSnapshots.cpp
+ * Author      Group 11
+ * Date        October 2026
+ * Version     0.3
+*/
+
+#include "Support/GenerationSnapshots.h"
+
+// Take over the frame of the other object, releasing the own frame first.
+PinnedFrame& PinnedFrame::operator=(PinnedFrame&& other) noexcept {
+    if (this != &other) {
+        release();
+        owner = other.owner;
+        slot = other.slot;
+        other.slot = -1;
+    }
+    return *this;
+}
+
+// Give the frame back, the simulation may reuse the buffer once no reader has it.
+void PinnedFrame::release() {
+    if (slot >= 0)
+        owner->unpin(slot);
+    slot = -1;
+}
+
+// The pinned frame, if any.
+const Frame* PinnedFrame::get() const {
+    return (slot >= 0) ? &owner->slots[slot].frame : nullptr;
+}
+
+// Create the buffers, at least two so one can be written while one is current.
+GenerationSnapshots::GenerationSnapshots(int buffers)
+        : slots(buffers < 2 ? 2 : buffers), current(-1), writing(-1), skippedGenerations(0) {
+    for (auto & slot : slots)
+        slot.readers = 0;
+}
+
+// Find a buffer that is neither current nor pinned.
+Frame* GenerationSnapshots::beginWrite() {
+    int currentSlot = current.load();
+    for (int slot = 0; slot < static_cast<int>(slots.size()); slot++) {
+        if (slot != currentSlot && slots[slot].readers.load() == 0) {
+            writing = slot;
+            return &slots[slot].frame;
+        }
+    }
+    skippedGenerations++;
+    return nullptr;
+}
+
+// The written buffer becomes the current generation.
+void GenerationSnapshots::publish() {
+    current.store(writing);
+    writing = -1;
+}
+
+// Pin the current buffer, and check that it is still current once pinned.
+PinnedFrame GenerationSnapshots::pin() {
+    while (true) {
+        int slot = current.load();
+        if (slot < 0)
+            return PinnedFrame();
+
+        slots[slot].readers++;
+
+        // if the buffer was replaced before it was pinned, it may be written to
+        if (current.load() == slot)
+            return PinnedFrame(this, slot);
+
+        slots[slot].readers--;
+    }
+}
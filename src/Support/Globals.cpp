@@ -1,11 +0,0 @@
-/*
- * Filename    Globals.cpp
- * Author      Erik Ström
- * Date        October 2017
- * Version     0.1
-*/
-
-#include "Support/Globals.h"
-
-string fileName;
-Dimensions WORLD_DIMENSIONS = { 80, 24 };
\ No newline at end of file
@@ -0,0 +1,60 @@
+/*
+ * Filename    HaloRing.cpp
+ * Author      Group 11
+ * Date        October 2026
+ * Version     0.3
+*/
+
+#include "Support/HaloRing.h"
+#include <chrono>
+#include <cstring>
+#include <ios>
+#include <new>
+#include <thread>
+#include <type_traits>
+
+static_assert(is_trivially_copyable<Cell>::value, "cells are copied as bytes between processes");
+
+// The counters, followed by the rows.
+size_t HaloRing::getSize(size_t rowCells, size_t slots) {
+    return sizeof(Counters) + rowCells * (slots > 0 ? slots : 1) * sizeof(Cell);
+}
+
+// Create the counters in the block, the ring starts empty.
+HaloRing::HaloRing(void* memory, size_t rowCells, size_t slots, const atomic<int>* aborted)
+        : counters(new (memory) Counters()), rowCells(rowCells), slots(slots > 0 ? slots : 1),
+          aborted(aborted) {
+    rows = reinterpret_cast<Cell*>(static_cast<char*>(memory) + sizeof(Counters));
+    counters->writeCount.store(0);
+    counters->readCount.store(0);
+}
+
+// Give way to the other process, unless it has failed.
+void HaloRing::waitOnce() const {
+    if (aborted != nullptr && aborted->load() != 0)
+        throw ios_base::failure("A neighbouring slab has failed");
+    this_thread::yield();
+}
+
+// Copy the row into the next free slot.
+void HaloRing::push(const Cell* row) {
+    unsigned long written = counters->writeCount.load(memory_order_relaxed);
+    while (written - counters->readCount.load(memory_order_acquire) >= slots)
+        waitOnce();
+
+    memcpy(rows + (written % slots) * rowCells, row, rowCells * sizeof(Cell));
+    counters->writeCount.store(written + 1, memory_order_release);
+}
+
+// Copy the oldest row out of its slot.
+double HaloRing::pop(Cell* row) {
+    chrono::steady_clock::time_point start = chrono::steady_clock::now();
+    unsigned long read = counters->readCount.load(memory_order_relaxed);
+    while (counters->writeCount.load(memory_order_acquire) == read)
+        waitOnce();
+    double waited = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+
+    memcpy(row, rows + (read % slots) * rowCells, rowCells * sizeof(Cell));
+    counters->readCount.store(read + 1, memory_order_release);
+    return waited;
+}
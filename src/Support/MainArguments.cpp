@@ -28,9 +28,9 @@ void GenerationsArgument::execute(ApplicationValues& appValues, char* generation
 void WorldsizeArgument::execute(ApplicationValues& appValues, char* dimensions) {
     if (dimensions) {
         istringstream iss(dimensions);
-        iss >> WORLD_DIMENSIONS.WIDTH;
+        iss >> appValues.world.dimensions.WIDTH;
         iss.get();
-        iss >> WORLD_DIMENSIONS.HEIGHT;
+        iss >> appValues.world.dimensions.HEIGHT;
     }
     else {
         printNoValue();
@@ -40,7 +40,7 @@ void WorldsizeArgument::execute(ApplicationValues& appValues, char* dimensions)
 
 void FileArgument::execute(ApplicationValues& appValues, char* fileNameArg) {
     if (fileNameArg) {
-        fileName = fileNameArg;
+        appValues.world.fileName = fileNameArg;
     }
     else {
         printNoValue();
@@ -66,4 +66,317 @@ void OddRuleArgument::execute(ApplicationValues& appValues, char* oddRule) {
         printNoValue();
         appValues.runSimulation = false;
     }
-}
\ No newline at end of file
+}
+
+void RuleMapArgument::execute(ApplicationValues& appValues, char* ruleMapFile) {
+    if (ruleMapFile) {
+        appValues.ruleMapFileName = ruleMapFile;
+    }
+    else {
+        printNoValue();
+        appValues.runSimulation = false;
+    }
+}
+
+void PluginDirectoryArgument::execute(ApplicationValues& appValues, char* directory) {
+    if (directory) {
+        appValues.pluginDirectory = directory;
+    }
+    else {
+        printNoValue();
+        appValues.runSimulation = false;
+    }
+}
+
+void GenerationsPerSweepArgument::execute(ApplicationValues& appValues, char* generations) {
+    if (generations) {
+        appValues.generationsPerSweep = stoi(generations);
+    }
+    else {
+        printNoValue();
+        appValues.runSimulation = false;
+    }
+}
+
+void ThreadCountArgument::execute(ApplicationValues& appValues, char* threads) {
+    if (threads) {
+        appValues.threadCount = stoi(threads);
+    }
+    else {
+        printNoValue();
+        appValues.runSimulation = false;
+    }
+}
+
+void SchedulerArgument::execute(ApplicationValues& appValues, char* scheduler) {
+    if (scheduler && (string(scheduler) == "bands" || string(scheduler) == "stealing")) {
+        appValues.workStealing = string(scheduler) == "stealing";
+    }
+    else if (scheduler) {
+        ScreenPrinter::getInstance().printMessage("Unknown scheduler " + string(scheduler) + "!");
+        appValues.runSimulation = false;
+    }
+    else {
+        printNoValue();
+        appValues.runSimulation = false;
+    }
+}
+
+void PinThreadsArgument::execute(ApplicationValues& appValues, char* pinning) {
+    if (pinning && (string(pinning) == "on" || string(pinning) == "off")) {
+        appValues.pinThreads = string(pinning) == "on";
+    }
+    else if (pinning) {
+        ScreenPrinter::getInstance().printMessage("Unknown thread pinning " + string(pinning) + "!");
+        appValues.runSimulation = false;
+    }
+    else {
+        printNoValue();
+        appValues.runSimulation = false;
+    }
+}
+
+void ProcessCountArgument::execute(ApplicationValues& appValues, char* processes) {
+    if (processes) {
+        appValues.processCount = stoi(processes);
+    }
+    else {
+        printNoValue();
+        appValues.runSimulation = false;
+    }
+}
+
+void RandomSeedArgument::execute(ApplicationValues& appValues, char* seed) {
+    if (seed) {
+        appValues.world.randomFill.seed = static_cast<unsigned int>(stoul(seed));
+    }
+    else {
+        printNoValue();
+        appValues.runSimulation = false;
+    }
+}
+
+void LiveDensityArgument::execute(ApplicationValues& appValues, char* density) {
+    if (density && stod(density) >= 0.0 && stod(density) <= 1.0) {
+        appValues.world.randomFill.liveDensity = stod(density);
+    }
+    else if (density) {
+        ScreenPrinter::getInstance().printMessage("The density must be between 0 and 1!");
+        appValues.runSimulation = false;
+    }
+    else {
+        printNoValue();
+        appValues.runSimulation = false;
+    }
+}
+
+void EnsembleArgument::execute(ApplicationValues& appValues, char* seeds) {
+    if (seeds && stoi(seeds) > 0) {
+        appValues.ensembleSeeds = stoi(seeds);
+    }
+    else if (seeds) {
+        ScreenPrinter::getInstance().printMessage("The ensemble needs at least one seed!");
+        appValues.runSimulation = false;
+    }
+    else {
+        printNoValue();
+        appValues.runSimulation = false;
+    }
+}
+
+void AutotuneArgument::execute(ApplicationValues& appValues, char* autotune) {
+    if (autotune && (string(autotune) == "on" || string(autotune) == "off")) {
+        appValues.autotune = string(autotune) == "on";
+    }
+    else if (autotune) {
+        ScreenPrinter::getInstance().printMessage("Unknown autotuning " + string(autotune) + "!");
+        appValues.runSimulation = false;
+    }
+    else {
+        printNoValue();
+        appValues.runSimulation = false;
+    }
+}
+
+void HeadlessArgument::execute(ApplicationValues& appValues, char* headless) {
+    if (headless && (string(headless) == "on" || string(headless) == "off")) {
+        appValues.headless = string(headless) == "on";
+    }
+    else if (headless) {
+        ScreenPrinter::getInstance().printMessage("Unknown headless mode " + string(headless) + "!");
+        appValues.runSimulation = false;
+    }
+    else {
+        printNoValue();
+        appValues.runSimulation = false;
+    }
+}
+
+void FramesPerSecondArgument::execute(ApplicationValues& appValues, char* rate) {
+    if (rate && stod(rate) >= 0.0) {
+        appValues.framesPerSecond = stod(rate);
+    }
+    else if (rate) {
+        ScreenPrinter::getInstance().printMessage("The frames per second can not be negative!");
+        appValues.runSimulation = false;
+    }
+    else {
+        printNoValue();
+        appValues.runSimulation = false;
+    }
+}
+
+void GenerationsPerSecondArgument::execute(ApplicationValues& appValues, char* rate) {
+    if (rate && stod(rate) >= 0.0) {
+        appValues.generationsPerSecond = stod(rate);
+    }
+    else if (rate) {
+        ScreenPrinter::getInstance().printMessage("The generations per second can not be negative!");
+        appValues.runSimulation = false;
+    }
+    else {
+        printNoValue();
+        appValues.runSimulation = false;
+    }
+}
+
+void DownsampleArgument::execute(ApplicationValues& appValues, char* mode) {
+    if (mode && string(mode) == "cells") {
+        appValues.downsampleMode = DownsampleMode::CELLS;
+    }
+    else if (mode && string(mode) == "half") {
+        appValues.downsampleMode = DownsampleMode::HALF_BLOCKS;
+    }
+    else if (mode && string(mode) == "braille") {
+        appValues.downsampleMode = DownsampleMode::BRAILLE;
+    }
+    else if (mode) {
+        ScreenPrinter::getInstance().printMessage("Unknown downsampling " + string(mode) + "!");
+        appValues.runSimulation = false;
+    }
+    else {
+        printNoValue();
+        appValues.runSimulation = false;
+    }
+}
+
+void ViewportArgument::execute(ApplicationValues& appValues, char* corner) {
+    int column = -1, row = -1;
+    bool numeric = false;
+    if (corner) {
+        istringstream iss(corner);
+        iss >> column;
+        iss.get();
+        iss >> row;
+        numeric = !iss.fail();
+    }
+
+    if (corner && numeric && column >= 0 && row >= 0) {
+        appValues.viewport.column = column;
+        appValues.viewport.row = row;
+    }
+    else if (corner) {
+        ScreenPrinter::getInstance().printMessage("The viewport must be a column and row of at least 0!");
+        appValues.runSimulation = false;
+    }
+    else {
+        printNoValue();
+        appValues.runSimulation = false;
+    }
+}
+
+void ZoomArgument::execute(ApplicationValues& appValues, char* zoom) {
+    if (zoom && stoi(zoom) >= 1) {
+        appValues.viewport.zoom = stoi(zoom);
+    }
+    else if (zoom) {
+        ScreenPrinter::getInstance().printMessage("The zoom must be at least 1!");
+        appValues.runSimulation = false;
+    }
+    else {
+        printNoValue();
+        appValues.runSimulation = false;
+    }
+}
+
+void SynchronizedOutputArgument::execute(ApplicationValues& appValues, char* synchronized) {
+    if (synchronized && (string(synchronized) == "on" || string(synchronized) == "off")) {
+        appValues.synchronizedOutput = string(synchronized) == "on";
+    }
+    else if (synchronized) {
+        ScreenPrinter::getInstance().printMessage("Unknown synchronized output mode " + string(synchronized) + "!");
+        appValues.runSimulation = false;
+    }
+    else {
+        printNoValue();
+        appValues.runSimulation = false;
+    }
+}
+
+void ExportDirectoryArgument::execute(ApplicationValues& appValues, char* directory) {
+    if (directory) {
+        appValues.exportDirectory = directory;
+    }
+    else {
+        printNoValue();
+        appValues.runSimulation = false;
+    }
+}
+
+void ExportEveryArgument::execute(ApplicationValues& appValues, char* every) {
+    if (every && stoi(every) >= 1) {
+        appValues.exportEvery = stoi(every);
+    }
+    else if (every) {
+        ScreenPrinter::getInstance().printMessage("The generations between two images must be at least 1!");
+        appValues.runSimulation = false;
+    }
+    else {
+        printNoValue();
+        appValues.runSimulation = false;
+    }
+}
+
+void ExportFormatArgument::execute(ApplicationValues& appValues, char* format) {
+    if (format && string(format) == "ppm") {
+        appValues.exportFormat = ImageFormat::PPM;
+    }
+    else if (format && string(format) == "png") {
+        appValues.exportFormat = ImageFormat::PNG;
+    }
+    else if (format) {
+        ScreenPrinter::getInstance().printMessage("Unknown image format " + string(format) + "!");
+        appValues.runSimulation = false;
+    }
+    else {
+        printNoValue();
+        appValues.runSimulation = false;
+    }
+}
+
+void StreamArgument::execute(ApplicationValues& appValues, char* path) {
+    if (path) {
+        appValues.streamPath = path;
+    }
+    else {
+        printNoValue();
+        appValues.runSimulation = false;
+    }
+}
+
+void StreamFormatArgument::execute(ApplicationValues& appValues, char* format) {
+    if (format && string(format) == "rgb") {
+        appValues.streamFormat = PixelFormat::RGB;
+    }
+    else if (format && string(format) == "palette") {
+        appValues.streamFormat = PixelFormat::PALETTE;
+    }
+    else if (format) {
+        ScreenPrinter::getInstance().printMessage("Unknown pixel format " + string(format) + "!");
+        appValues.runSimulation = false;
+    }
+    else {
+        printNoValue();
+        appValues.runSimulation = false;
+    }
+}
@@ -12,7 +12,18 @@
 ApplicationValues &MainArgumentsParser::runParser(char *argv[], int length) {
 
     vector<BaseArgument *> arguments = {new HelpArgument, new GenerationsArgument, new WorldsizeArgument,
-                                        new FileArgument, new EvenRuleArgument, new OddRuleArgument};
+                                        new FileArgument, new EvenRuleArgument, new OddRuleArgument,
+                                        new RuleMapArgument, new PluginDirectoryArgument,
+                                        new GenerationsPerSweepArgument, new ThreadCountArgument,
+                                        new SchedulerArgument, new PinThreadsArgument,
+                                        new ProcessCountArgument, new RandomSeedArgument,
+                                        new LiveDensityArgument, new EnsembleArgument,
+                                        new AutotuneArgument, new HeadlessArgument,
+                                        new FramesPerSecondArgument, new GenerationsPerSecondArgument,
+                                        new DownsampleArgument, new ViewportArgument, new ZoomArgument,
+                                        new SynchronizedOutputArgument, new ExportDirectoryArgument,
+                                        new ExportEveryArgument, new ExportFormatArgument, new StreamArgument,
+                                        new StreamFormatArgument};
 
     for (auto arg : arguments) {
         const string& argValue = arg->getValue();
@@ -0,0 +1,38 @@
+/*
+ * Filename    Pacer.cpp
+ * Author      Group 11
+ * Date        October 2026
+ * Version     0.3
+*/
+
+#include "Support/Pacer.h"
+#include <thread>
+
+// An interval of zero does not pace.
+Pacer::Pacer(double ticksPerSecond)
+        : interval(ticksPerSecond > 0.0
+                   ? chrono::duration_cast<chrono::steady_clock::duration>(chrono::duration<double>(1.0 / ticksPerSecond))
+                   : chrono::steady_clock::duration::zero()),
+          start(chrono::steady_clock::now()), deadline(start), lastTick(start), ticks(0) {}
+
+// Move the deadline by whole intervals, so the rate does not drift.
+void Pacer::wait(int count) {
+    auto now = chrono::steady_clock::now();
+    ticks += count;
+    lastTick = now;
+    if (interval == chrono::steady_clock::duration::zero())
+        return;
+
+    deadline += interval * count;
+
+    // more than one interval behind, drop the missed deadlines
+    if (now > deadline + interval)
+        deadline = now;
+    this_thread::sleep_until(deadline);
+}
+
+// Ticks over the time from the creation to the last tick.
+double Pacer::getAchievedRate() const {
+    double seconds = chrono::duration<double>(lastTick - start).count();
+    return seconds > 0.0 ? ticks / seconds : 0.0;
+}
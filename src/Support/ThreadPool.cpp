@@ -0,0 +1,136 @@
+/*
+ * Filename    ThreadPool.cpp
+ * Author      Group 11
+ * Date        October 2026
+ * Version     0.3
+*/
+
+#include "Support/ThreadPool.h"
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+// Start the threads, the calling thread is worker 0.
+ThreadPool::ThreadPool(int threadCount)
+        : round(0), running(0), stopping(false),
+          affinity(threadCount > 1 ? threadCount : 1, -1), pinPending(affinity.size(), 0) {
+    for (int worker = 1; worker < threadCount; worker++)
+        workers.emplace_back(&ThreadPool::workerLoop, this, worker);
+}
+
+// Stop the threads and wait for them to finish.
+ThreadPool::~ThreadPool() {
+    {
+        lock_guard<mutex> lock(poolMutex);
+        stopping = true;
+    }
+    startTask.notify_all();
+
+    for (auto & worker : workers)
+        worker.join();
+}
+
+// Run the task on all workers, returns when all of them are done.
+void ThreadPool::run(const function<void(int)>& newTask) {
+    int ownCpu;
+    {
+        lock_guard<mutex> lock(poolMutex);
+        task = newTask;
+        running = static_cast<int>(workers.size());
+        failure = nullptr;
+        round++;
+
+        // worker 0 is whichever thread calls run, pin it if it has changed
+        ownCpu = takePendingCpu(0);
+        if (ownCpu < 0 && affinity[0] >= 0 && pinnedCaller != this_thread::get_id())
+            ownCpu = affinity[0];
+        pinnedCaller = this_thread::get_id();
+    }
+    startTask.notify_all();
+
+    // the calling thread does its part as worker 0
+    exception_ptr ownFailure;
+    try {
+        if (ownCpu >= 0)
+            pinCurrentThread(ownCpu);
+        newTask(0);
+    }
+    catch (...) {
+        ownFailure = current_exception();
+    }
+
+    unique_lock<mutex> lock(poolMutex);
+    taskDone.wait(lock, [this] { return running == 0; });
+
+    if (ownFailure)
+        rethrow_exception(ownFailure);
+    if (failure)
+        rethrow_exception(failure);
+}
+
+// Wait for a new round and run its task, until the pool is stopped.
+void ThreadPool::workerLoop(int worker) {
+    unsigned long doneRounds = 0;
+
+    while (true) {
+        unique_lock<mutex> lock(poolMutex);
+        startTask.wait(lock, [this, doneRounds] { return stopping || round != doneRounds; });
+        if (stopping)
+            return;
+        doneRounds = round;
+        int cpu = takePendingCpu(worker);
+        lock.unlock();
+
+        if (cpu >= 0)
+            pinCurrentThread(cpu);
+
+        exception_ptr taskFailure;
+        try {
+            task(worker);
+        }
+        catch (...) {
+            taskFailure = current_exception();
+        }
+
+        lock.lock();
+        if (taskFailure && !failure)
+            failure = taskFailure;
+        if (--running == 0)
+            taskDone.notify_one();
+    }
+}
+
+// Remember the CPU of each worker, they pin themselves on their next task.
+void ThreadPool::pinWorkers(const vector<int>& cpus) {
+    lock_guard<mutex> lock(poolMutex);
+    for (size_t worker = 0; worker < affinity.size() && worker < cpus.size(); worker++) {
+        affinity[worker] = cpus[worker];
+        pinPending[worker] = 1;
+    }
+}
+
+// The new CPU of the worker, if it has one.
+int ThreadPool::takePendingCpu(int worker) {
+    if (!pinPending[worker])
+        return -1;
+    pinPending[worker] = 0;
+    return affinity[worker];
+}
+
+// Restrict the calling thread to one CPU.
+bool ThreadPool::pinCurrentThread(int cpu) {
+#ifdef __linux__
+    if (cpu < 0 || cpu >= CPU_SETSIZE)
+        return false;
+
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(cpu, &set);
+    return pthread_setaffinity_np(pthread_self(), sizeof(set), &set) == 0;
+#else
+    (void)cpu;
+    return false;
+#endif
+}
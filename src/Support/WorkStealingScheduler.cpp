@@ -0,0 +1,97 @@
+/*
+ * Filename    WorkStealingScheduler.cpp
+ * Author      Group 11
+ * Date        October 2026
+ * Version     0.3
+*/
+
+#include "Support/WorkStealingScheduler.h"
+#include <algorithm>
+
+// One queue and one stats entry for each worker of the pool.
+WorkStealingScheduler::WorkStealingScheduler(ThreadPool& pool)
+        : pool(pool), queues(pool.getThreadCount()), stats(pool.getThreadCount()) {
+    resetStats();
+    setWorkerNodes(vector<int>(queues.size(), 0));
+}
+
+// Order the victims of each worker, own node first, starting with the next worker.
+void WorkStealingScheduler::setWorkerNodes(const vector<int>& nodes) {
+    int workers = static_cast<int>(queues.size());
+    victims.assign(workers, vector<int>());
+    for (int worker = 0; worker < workers; worker++) {
+        int node = (worker < static_cast<int>(nodes.size())) ? nodes[worker] : 0;
+
+        // start with the next worker, so the thieves spread over the queues
+        for (int pass = 0; pass < 2; pass++) {
+            for (int offset = 1; offset < workers; offset++) {
+                int victim = (worker + offset) % workers;
+                int victimNode = (victim < static_cast<int>(nodes.size())) ? nodes[victim] : 0;
+                if ((victimNode == node) == (pass == 0))
+                    victims[worker].push_back(victim);
+            }
+        }
+    }
+}
+
+// Sets all worker stats to zero.
+void WorkStealingScheduler::resetStats() {
+    for (auto & workerStats : stats)
+        workerStats = WorkerStats{0, 0, 0.0};
+}
+
+// Take a task from the back of the own queue, or steal from the front of another.
+bool WorkStealingScheduler::nextTask(int worker, size_t& task) {
+    {
+        lock_guard<mutex> lock(queues[worker].queueMutex);
+        if (!queues[worker].tasks.empty()) {
+            task = queues[worker].tasks.back();
+            queues[worker].tasks.pop_back();
+            return true;
+        }
+    }
+
+    for (int victimIndex : victims[worker]) {
+        WorkerQueue& victim = queues[victimIndex];
+        lock_guard<mutex> lock(victim.queueMutex);
+        if (!victim.tasks.empty()) {
+            task = victim.tasks.front();
+            victim.tasks.pop_front();
+            stats[worker].steals++;
+            return true;
+        }
+    }
+    return false;
+}
+
+// Run the tasks without telling which worker runs them.
+void WorkStealingScheduler::run(const vector<size_t>& tasks, const function<void(size_t)>& work) {
+    run(tasks, [&work](int, size_t task) { work(task); });
+}
+
+// Hand out the tasks in chunks and let the workers run and steal them.
+void WorkStealingScheduler::run(const vector<size_t>& tasks, const function<void(int, size_t)>& work) {
+    size_t workers = queues.size();
+    for (size_t worker = 0; worker < workers; worker++) {
+        size_t first = tasks.size() * worker / workers;
+        size_t last = tasks.size() * (worker + 1) / workers;
+        queues[worker].tasks.assign(tasks.begin() + first, tasks.begin() + last);
+    }
+
+    vector<chrono::steady_clock::time_point> finished(workers);
+    pool.run([&](int worker) {
+        size_t task;
+        while (nextTask(worker, task)) {
+            work(worker, task);
+            stats[worker].tasks++;
+        }
+        finished[worker] = chrono::steady_clock::now();
+    });
+
+    // the workers waited from when they were done until the last one was
+    chrono::steady_clock::time_point lastFinished = finished.front();
+    for (auto & time : finished)
+        lastFinished = max(lastFinished, time);
+    for (size_t worker = 0; worker < workers; worker++)
+        stats[worker].idleSeconds += chrono::duration<double>(lastFinished - finished[worker]).count();
+}
@@ -6,7 +6,12 @@
 */
 
 #include <iostream>
+#include <memory>
 #include "GameOfLife.h"
+#include "SlabSimulation.h"
+#include "EnsembleRunner.h"
+#include "Autotuner.h"
+#include "GoL_Rules/RuleFactory.h"
 #include "Support/MainArgumentsParser.h"
 
 #ifdef DEBUG
@@ -20,11 +25,108 @@ int main(int argc, char* argv[]) {
     MainArgumentsParser parser;
     ApplicationValues appValues = parser.runParser(argv, argc);
 
-    if (appValues.runSimulation) {
+    // The standard output is the stream, print everything else to the standard error
+    if (appValues.runSimulation && appValues.streamPath == "-")
+        cout.rdbuf(cerr.rdbuf());
+
+    // Register rules from plugins before they are selected by name
+    if (appValues.runSimulation && !appValues.pluginDirectory.empty()) {
+        if (RuleFactory::getInstance().loadPlugins(appValues.pluginDirectory) == 0)
+            ScreenPrinter::getInstance().printMessage("No rule plugins found in " + appValues.pluginDirectory);
+    }
+
+    if (appValues.runSimulation && appValues.ensembleSeeds > 0) {
+        // Simulate one world per seed without presenting them
+        try {
+            EnsembleRunner ensemble(appValues.world, appValues.evenRuleName, appValues.oddRuleName,
+                                    appValues.ruleMapFileName, appValues.maxGenerations, appValues.threadCount);
+            ScreenPrinter::getInstance().printEnsembleResults(ensemble.run(appValues.ensembleSeeds));
+        }
+        catch(ios_base::failure &e){}
+    }
+    else if (appValues.runSimulation && appValues.processCount > 1) {
+        // Calculate slabs of the world in worker processes, each building only its own rows
+        try {
+            SlabSimulation slabs(appValues.world, appValues.evenRuleName, appValues.oddRuleName,
+                                 appValues.ruleMapFileName, DEFAULT_TILE_SIZE, appValues.processCount);
+            Frame frame;
+            slabs.run(appValues.maxGenerations, appValues.headless ? nullptr : &frame);
+
+            // The last generation is gathered and shown, unless headless
+            if (!appValues.headless) {
+                ScreenPrinter::getInstance().setDownsampling(appValues.downsampleMode, appValues.viewport);
+                ScreenPrinter::getInstance().printBoard(frame);
+            }
+            ScreenPrinter::getInstance().printSlabStats(slabs.getStats());
+        }
+        catch(ios_base::failure &e){}
+    }
+    else if (appValues.runSimulation) {
         // Start simulation
         try {
-            GameOfLife gameOfLife = GameOfLife(appValues.maxGenerations, appValues.evenRuleName, appValues.oddRuleName);
-            gameOfLife.runSimulation();
+            // Choose the threads and tile size by timing a few generations, unless cached
+            int tileSize = DEFAULT_TILE_SIZE;
+            if (appValues.autotune) {
+                Autotuner autotuner(appValues.world, appValues.evenRuleName, appValues.oddRuleName,
+                                    appValues.ruleMapFileName);
+                TuningChoice choice = autotuner.tune();
+                appValues.threadCount = choice.threads;
+                tileSize = choice.tileSize;
+                ScreenPrinter::getInstance().printMessage("Autotuned to " + to_string(choice.threads) + " threads and "
+                                                          + to_string(choice.tileSize) + " cell tiles"
+                                                          + (autotuner.wasCalibrated() ? "" : " (cached)"));
+            }
+
+            GameOfLife gameOfLife = GameOfLife(appValues.maxGenerations, appValues.evenRuleName, appValues.oddRuleName,
+                                                appValues.ruleMapFileName, appValues.world, tileSize,
+                                                appValues.threadCount);
+            gameOfLife.setPacing(appValues.framesPerSecond, appValues.generationsPerSecond);
+            ScreenPrinter::getInstance().setDownsampling(appValues.downsampleMode, appValues.viewport);
+            gameOfLife.getPopulation().setGenerationsPerSweep(appValues.generationsPerSweep);
+            gameOfLife.getPopulation().setWorkStealing(appValues.workStealing);
+            gameOfLife.getPopulation().setThreadPinning(appValues.pinThreads);
+
+            // Write the generations as images on threads of their own
+            unique_ptr<ImageExporter> exporter;
+            if (!appValues.exportDirectory.empty()) {
+                exporter = make_unique<ImageExporter>(appValues.exportDirectory, appValues.exportEvery,
+                                                      appValues.exportFormat);
+                gameOfLife.setExporter(exporter.get());
+            }
+
+            // Stream the frames instead of printing them
+            unique_ptr<FrameStreamer> streamer;
+            if (!appValues.streamPath.empty()) {
+                streamer = make_unique<FrameStreamer>(appValues.streamPath, appValues.streamFormat,
+                                                      appValues.framesPerSecond);
+                gameOfLife.setStreamer(streamer.get());
+            }
+
+            if (appValues.headless)
+                ScreenPrinter::getInstance().printHeadlessStats(gameOfLife.runHeadless());
+            else {
+                ScreenPrinter::getInstance().setSynchronizedOutput(appValues.synchronizedOutput && !streamer);
+                gameOfLife.runSimulation();
+                ScreenPrinter::getInstance().setSynchronizedOutput(false);
+                cout << endl;
+                if (streamer)
+                    ScreenPrinter::getInstance().printStreamStats(streamer->getStats());
+                else
+                    ScreenPrinter::getInstance().printRenderStats(ScreenPrinter::getInstance().getRenderStats());
+                ScreenPrinter::getInstance().printPacingStats(gameOfLife.getPacingStats());
+            }
+
+            // Wait for the last images
+            if (exporter)
+                ScreenPrinter::getInstance().printExportStats(exporter->finish());
+
+            // Report how the tiles were balanced between the threads
+            if (appValues.workStealing)
+                ScreenPrinter::getInstance().printWorkerStats(gameOfLife.getPopulation().getWorkerStats());
+
+            // Report the cell bandwidth of each NUMA node
+            if (appValues.pinThreads)
+                ScreenPrinter::getInstance().printNodeStats(gameOfLife.getPopulation().getNodeStats());
         }
         catch(ios_base::failure &e){}
 
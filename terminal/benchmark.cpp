@@ -0,0 +1,118 @@
+/*
+ * Autor       : Group 11
+ * Filename    : benchmark.cpp
+ * Description : Microbenchmark of the color manipulators of Terminal lib, counting allocations per color switch.
+ *
+*/
+
+#include "terminal.h"
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <new>
+
+using namespace std;
+
+static atomic<unsigned long> allocations(0);
+
+void* operator new(size_t size)
+{
+    allocations++;
+    if(void* memory = malloc(size ? size : 1))
+    {
+        return memory;
+    }
+    throw bad_alloc();
+}
+
+void operator delete(void* memory) noexcept
+{
+    free(memory);
+}
+
+void operator delete(void* memory, size_t) noexcept
+{
+    free(memory);
+}
+
+// Stream buffer throwing away everything, so printing does not allocate
+class NullBuffer : public streambuf
+{
+protected:
+    int overflow(int c) override
+    {
+        return c;
+    }
+    streamsize xsputn(const char*, streamsize count) override
+    {
+        return count;
+    }
+};
+
+const int SWITCHES = 1000000;
+
+template<typename Switch>
+void measure(const char* name, Switch colorSwitch)
+{
+    // once before measuring, so the color stack has its memory
+    colorSwitch();
+
+    unsigned long before = allocations;
+    auto start = chrono::steady_clock::now();
+    for(int i = 0; i < SWITCHES; i++)
+    {
+        colorSwitch();
+    }
+    double seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+    unsigned long allocated = allocations - before;
+
+    cerr << name << ": " << seconds * 1e9 / SWITCHES << " ns and "
+         << static_cast<double>(allocated) / SWITCHES << " allocations per color switch" << endl;
+}
+
+int main()
+{
+    NullBuffer nullBuffer;
+    streambuf* standardOutput = cout.rdbuf(&nullBuffer);
+    {
+        Terminal terminal;
+        TerminalColor green(COLOR::GREEN, COLOR::BLACK);
+
+        measure("pushColor/popColor", [&]
+        {
+            terminal.pushColor(green);
+            terminal.popColor();
+        });
+        measure("color", [&]
+        {
+            cout << terminal.color(green);
+            terminal.popColor();
+        });
+        measure("strColor", [&]
+        {
+            cout << terminal.strColor(green)("#");
+        });
+        measure("position", [&]
+        {
+            cout << terminal.position()(10, 20);
+        });
+        // the closures the manipulators replaced, for comparison
+        measure("std::function closure", [&]
+        {
+            function<function<ostream&(ostream&)>(const string&)> strColor = [&](const string& str)
+            {
+                return function<ostream&(ostream&)>([&, str](ostream& os) -> ostream&
+                {
+                    terminal.pushColor(green);
+                    os << str.c_str();
+                    terminal.popColor();
+                    return os;
+                });
+            };
+            cout << strColor("a string longer than the small string buffer");
+        });
+    }
+    cout.rdbuf(standardOutput);
+    return 0;
+}
@@ -7,51 +7,73 @@
 */
 
 #include "terminal.h"
+#include <cstdio>
+#include <cstring>
 
-std::ostream &operator<<(std::ostream &os, std::function<std::ostream &(std::ostream &)> function)
-{
-    return function(os);
-}
+#ifndef _WIN32
+#include <cerrno>
+#include <unistd.h>
+#endif
 
-void Terminal::pushColor(const TerminalColor &color)
+namespace
 {
-    setColor(color);
-    m_colors.push(color);
-}
+    // Numbers below this are copied from the table, larger are formatted
+    const unsigned int TABLE_NUMBERS = 1000;
 
-std::function<std::function<std::ostream &(std::ostream &)> (const std::string &str)> Terminal::strColor(const TerminalColor &color)
-{
-    return [this, color](const std::string& str)->std::function<std::ostream &(std::ostream &)>
+    // Escape sequences and numbers of TerminalBuffer, built once
+    struct EscapeTables
     {
-        return [this, color, str](std::ostream& os)->std::ostream&
+        char numbers[TABLE_NUMBERS][4];
+        unsigned char numberLengths[TABLE_NUMBERS];
+        std::string colors[8][8];
+
+        EscapeTables()
         {
-            this->pushColor(color);
-            os << str.c_str();
-            this->popColor();
-            return os;
-        };
+            for(unsigned int number = 0; number < TABLE_NUMBERS; number++)
+            {
+                numberLengths[number] = static_cast<unsigned char>(
+                    std::snprintf(numbers[number], sizeof(numbers[number]), "%u", number));
+            }
+            // same sequence as Terminal::setColor
+            for(int fg = 0; fg < 8; fg++)
+            {
+                for(int bg = 0; bg < 8; bg++)
+                {
+                    colors[fg][bg] = std::string("\x1B[") + (fg == 0 ? '0' : '1') + ";" +
+                                     std::to_string(fg + 30) + ";" + std::to_string(bg + 40) + "m";
+                }
+            }
+        }
     };
+
+    const EscapeTables& escapeTables()
+    {
+        static const EscapeTables tables;
+        return tables;
+    }
+
+    // Copies the number to out, returns the number of characters
+    std::size_t formatNumber(char* out, unsigned int number)
+    {
+        const EscapeTables& tables = escapeTables();
+        if(number < TABLE_NUMBERS)
+        {
+            std::memcpy(out, tables.numbers[number], tables.numberLengths[number]);
+            return tables.numberLengths[number];
+        }
+        return static_cast<std::size_t>(std::snprintf(out, 16, "%u", number));
+    }
 }
 
-std::function<std::ostream &(std::ostream &)> Terminal::color(const TerminalColor &color)
+std::ostream &operator<<(std::ostream &os, std::function<std::ostream &(std::ostream &)> function)
 {
-    return [this, color](std::ostream& os)->std::ostream&
-    {
-        this->pushColor(color);
-        return os;
-    };
+    return function(os);
 }
 
-std::function<std::function<std::ostream&(std::ostream&)>(unsigned int x, unsigned int y)> Terminal::position()
+void Terminal::pushColor(const TerminalColor &color)
 {
-    return [this](unsigned int x, unsigned int y)->std::function<std::ostream&(std::ostream&)>
-    {
-        return [this, x, y](std::ostream& os)->std::ostream&
-        {
-            this->setCursor(x,y);
-            return os;
-        };
-    };
+    setColor(color);
+    m_colors.push(color);
 }
 
 Terminal::~Terminal()
@@ -213,9 +235,13 @@ void Terminal::resetCursor()
 
 void Terminal::setCursor(unsigned int x, unsigned int y)
 {
-    std::stringstream ss;
-    ss << "\033[" << y << ";" << x << "H";
-    std::cout << ss.str();
+    char sequence[40] = "\033[";
+    std::size_t length = 2;
+    length += formatNumber(sequence + length, y);
+    sequence[length++] = ';';
+    length += formatNumber(sequence + length, x);
+    sequence[length++] = 'H';
+    std::cout.write(sequence, static_cast<std::streamsize>(length));
 }
 
 void Terminal::showCursor(bool show)
@@ -232,9 +258,8 @@ void Terminal::showCursor(bool show)
 
 void Terminal::setColor(const TerminalColor &color)
 {
-    std::stringstream ss;
-    ss << "\x1B[" << (color.fg() == COLOR::BLACK ? '0' : '1') << ";" << cti(color.fg())+30 << ";" << cti(color.bg())+40 << "m";
-    std::cout << ss.str();
+    const std::string& sequence = escapeTables().colors[cti(color.fg()) & 7][cti(color.bg()) & 7];
+    std::cout.write(sequence.data(), static_cast<std::streamsize>(sequence.size()));
 }
 
 int Terminal::cti(COLOR c)
@@ -263,3 +288,154 @@ int Terminal::cti(COLOR c)
 }
 
 #endif
+
+void TerminalBuffer::clear()
+{
+    m_bytes.clear();
+}
+
+void TerminalBuffer::reserve(std::size_t bytes)
+{
+    m_bytes.reserve(bytes);
+}
+
+void TerminalBuffer::forgetState()
+{
+    m_cursorKnown = false;
+    m_colorKnown = false;
+}
+
+void TerminalBuffer::setCursor(unsigned int x, unsigned int y)
+{
+    if(m_cursorKnown && m_x == x && m_y == y)
+    {
+        return;
+    }
+    append("\033[", 2);
+    putNumber(y);
+    m_bytes.push_back(';');
+    putNumber(x);
+    m_bytes.push_back('H');
+    m_cursorKnown = true;
+    m_x = x;
+    m_y = y;
+}
+
+void TerminalBuffer::setColor(const TerminalColor &color)
+{
+    if(m_colorKnown && m_colorSet && m_color.fg() == color.fg() && m_color.bg() == color.bg())
+    {
+        return;
+    }
+    const std::string& sequence = escapeTables().colors[static_cast<int>(color.fg()) & 7][static_cast<int>(color.bg()) & 7];
+    append(sequence.data(), sequence.size());
+    m_colorKnown = true;
+    m_colorSet = true;
+    m_color = color;
+}
+
+void TerminalBuffer::resetColor()
+{
+    if(m_colorKnown && !m_colorSet)
+    {
+        return;
+    }
+    append("\x1B[0m", 4);
+    m_colorKnown = true;
+    m_colorSet = false;
+}
+
+void TerminalBuffer::showCursor(bool show)
+{
+    append(show ? "\e[?25h" : "\e[?25l", 6);
+}
+
+void TerminalBuffer::beginSynchronizedUpdate()
+{
+    append("\e[?2026h", 8);
+}
+
+void TerminalBuffer::endSynchronizedUpdate()
+{
+    append("\e[?2026l", 8);
+}
+
+void TerminalBuffer::useAlternateScreen(bool use)
+{
+    append(use ? "\e[?1049h" : "\e[?1049l", 8);
+    m_cursorKnown = false;
+    m_colorKnown = false;
+}
+
+void TerminalBuffer::write(const char *str, std::size_t length)
+{
+    append(str, length);
+    m_x += static_cast<unsigned int>(length);
+}
+
+void TerminalBuffer::putGlyph(char32_t codePoint)
+{
+    if(codePoint < 0x80)
+    {
+        m_bytes.push_back(static_cast<char>(codePoint));
+    }
+    else if(codePoint < 0x800)
+    {
+        m_bytes.push_back(static_cast<char>(0xC0 | (codePoint >> 6)));
+        m_bytes.push_back(static_cast<char>(0x80 | (codePoint & 0x3F)));
+    }
+    else if(codePoint < 0x10000)
+    {
+        m_bytes.push_back(static_cast<char>(0xE0 | (codePoint >> 12)));
+        m_bytes.push_back(static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F)));
+        m_bytes.push_back(static_cast<char>(0x80 | (codePoint & 0x3F)));
+    }
+    else
+    {
+        m_bytes.push_back(static_cast<char>(0xF0 | (codePoint >> 18)));
+        m_bytes.push_back(static_cast<char>(0x80 | ((codePoint >> 12) & 0x3F)));
+        m_bytes.push_back(static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F)));
+        m_bytes.push_back(static_cast<char>(0x80 | (codePoint & 0x3F)));
+    }
+    m_x++;
+}
+
+void TerminalBuffer::append(const char *str, std::size_t length)
+{
+    m_bytes.append(str, length);
+}
+
+void TerminalBuffer::putNumber(unsigned int number)
+{
+    char digits[16];
+    append(digits, formatNumber(digits, number));
+}
+
+// Writes the buffer and empties it, returns the number of write calls
+int TerminalBuffer::flush(int fd)
+{
+    int calls = 0;
+#ifdef _WIN32
+    (void)fd;
+    std::fwrite(m_bytes.data(), 1, m_bytes.size(), stdout);
+    std::fflush(stdout);
+    calls = 1;
+#else
+    std::size_t written = 0;
+    while(written < m_bytes.size())
+    {
+        ssize_t result = ::write(fd, m_bytes.data() + written, m_bytes.size() - written);
+        calls++;
+        if(result > 0)
+        {
+            written += static_cast<std::size_t>(result);
+        }
+        else if(result < 0 && errno != EINTR)
+        {
+            break;
+        }
+    }
+#endif
+    m_bytes.clear();
+    return calls;
+}
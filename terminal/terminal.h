@@ -11,6 +11,7 @@
 
 #include <functional>
 #include <string>
+#include <string_view>
 #include <ostream>
 #include <stack>
 
@@ -43,6 +44,52 @@ private:
     COLOR m_fg, m_bg;
 };
 
+class Terminal;
+
+/*
+ * Manipulators returned by Terminal::color, Terminal::strColor and
+ * Terminal::position. They are small values that are printed with an inline
+ * operator<<, so using them does not allocate memory. Text given to strColor
+ * is referred to, not copied, and must outlive the statement printing it.
+ */
+struct TerminalColorManipulator
+{
+    Terminal* terminal;
+    TerminalColor color;
+};
+
+struct TerminalColoredText
+{
+    Terminal* terminal;
+    TerminalColor color;
+    std::string_view text;
+};
+
+struct TerminalColoredTextMaker
+{
+    Terminal* terminal;
+    TerminalColor color;
+    TerminalColoredText operator()(std::string_view text) const
+    {
+        return TerminalColoredText{terminal, color, text};
+    }
+};
+
+struct TerminalPosition
+{
+    Terminal* terminal;
+    unsigned int x, y;
+};
+
+struct TerminalPositionMaker
+{
+    Terminal* terminal;
+    TerminalPosition operator()(unsigned int x, unsigned int y) const
+    {
+        return TerminalPosition{terminal, x, y};
+    }
+};
+
 class Terminal
 {
 public:
@@ -54,13 +101,22 @@ public:
     ~Terminal();
     void pushColor(const TerminalColor& color);
     void popColor();
-    std::function<std::function<std::ostream&(std::ostream&)>(const std::string& str)> strColor(const TerminalColor& color);
-    std::function<std::ostream&(std::ostream&)> color(const TerminalColor &color);
+    TerminalColoredTextMaker strColor(const TerminalColor& color)
+    {
+        return TerminalColoredTextMaker{this, color};
+    }
+    TerminalColorManipulator color(const TerminalColor &color)
+    {
+        return TerminalColorManipulator{this, color};
+    }
     void clearColors();
     void clear();
     void resetCursor();
     void setCursor(unsigned int x, unsigned int y);
-    std::function<std::function<std::ostream&(std::ostream&)>(unsigned int x, unsigned int y)>  position();
+    TerminalPositionMaker position()
+    {
+        return TerminalPositionMaker{this};
+    }
     void showCursor(bool show);
 private:
     void setColor(const TerminalColor& color);
@@ -72,4 +128,84 @@ private:
 #endif
 };
 
+inline std::ostream& operator<<(std::ostream& os, const TerminalColorManipulator& manipulator)
+{
+    manipulator.terminal->pushColor(manipulator.color);
+    return os;
+}
+
+inline std::ostream& operator<<(std::ostream& os, const TerminalColoredText& coloredText)
+{
+    coloredText.terminal->pushColor(coloredText.color);
+    os.write(coloredText.text.data(), static_cast<std::streamsize>(coloredText.text.size()));
+    coloredText.terminal->popColor();
+    return os;
+}
+
+inline std::ostream& operator<<(std::ostream& os, const TerminalPosition& position)
+{
+    position.terminal->setCursor(position.x, position.y);
+    return os;
+}
+
+/*
+ * Output buffer for whole frames of ANSI escape sequences and text. The
+ * sequences are copied from tables built once, so composing a frame does not
+ * format numbers or allocate memory once the buffer has grown to the size of a
+ * frame. flush() hands the whole buffer to the operating system at once.
+ *
+ * The buffer tracks the color and cursor position the terminal will have, and
+ * leaves out sequences that would not change them: a color that is already
+ * set, a reset when no color is set, or a cursor move to where the previous
+ * character left the cursor. Text is assumed to be printable characters on a
+ * single row, putGlyph() writes one character of any Unicode code point as
+ * UTF-8. Call forgetState() when something else may have written to the
+ * terminal, the next color and cursor move are then always written.
+ *
+ * beginSynchronizedUpdate() and endSynchronizedUpdate() wrap a frame in the
+ * DEC mode 2026 sequences, so terminals that support them show the frame at
+ * once instead of while it is drawn. Other terminals ignore them.
+ * useAlternateScreen() switches to and from the alternate screen buffer,
+ * the screen before it is restored when switching back.
+ */
+class TerminalBuffer
+{
+public:
+    void clear();
+    void reserve(std::size_t bytes);
+    void forgetState();
+    void setCursor(unsigned int x, unsigned int y);
+    void setColor(const TerminalColor& color);
+    void resetColor();
+    void showCursor(bool show);
+    void beginSynchronizedUpdate();
+    void endSynchronizedUpdate();
+    void useAlternateScreen(bool use);
+    void put(char c)
+    {
+        m_bytes.push_back(c);
+        m_x++;
+    }
+    void write(const char* str, std::size_t length);
+    void putGlyph(char32_t codePoint);
+    const char* data() const
+    {
+        return m_bytes.data();
+    }
+    std::size_t size() const
+    {
+        return m_bytes.size();
+    }
+    int flush(int fd);
+private:
+    void append(const char* str, std::size_t length);
+    void putNumber(unsigned int number);
+    std::string m_bytes;
+    bool m_cursorKnown = false;
+    unsigned int m_x = 0, m_y = 0;
+    bool m_colorKnown = false;
+    bool m_colorSet = false;
+    TerminalColor m_color;
+};
+
 #endif // CONSOLE_COLOR_H
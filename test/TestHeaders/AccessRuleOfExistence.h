@@ -102,8 +102,9 @@ class AccessRulesOfExistence : public RuleOfExistence {
    * @brief Stubbed function to make this class non abstract.
    * @details Since the parent class does not define any functionality for
    * this function it is enough to leave it as stubbed
+   * @param region part of the game board, not used
    */
-  virtual void executeRule(){};
+  void executeRule(const Region &) override {};
 };
 
 #endif //GAMEOFLIFE_TEST_TESTCLASSES_ACCESSRULESOFEXISTENCE_HPP_
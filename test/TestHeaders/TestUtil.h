@@ -22,6 +22,7 @@
 #include "TestUtilCell.h"
 #include "TestPoint.h"
 #include "Cell_Culture/Cell.h"
+#include "Cell_Culture/Frame.h"
 
 
 /**
@@ -38,8 +39,7 @@ static const char *ACTIONNames[] = {"KILL_CELL", "IGNORE_CELL",
 /**
  * @brief Creates a new empty game map of the defined size
  *
- * @details Sets the global WORLD_DIMENSIONS.HEIGHT and WIDTH to the
- * parameters. The raw size of the world will be width+2 and heigth+2 to
+ * @details Remembers the height and width, used by isPosRimCell. The raw size of the world will be width+2 and heigth+2 to
  * account for rim cells. If the rim cells should be defined as rim cells can
  * be defined in the input parameters
  *
@@ -151,5 +151,17 @@ void setCellAliveNeighbours(map<Point,Cell> &cells,
     TestPoint cellPos,
     std::vector<Directions> directions,
     int setNrAliveCells);
+
+/**
+ * @brief Creates a frame of dead cells, rim included
+ *
+ * @details Used by tests of the classes that render, export or stream
+ * frames. Every cell has the color STATE_COLORS.DEAD and generation is 0.
+ *
+ * @param width of the world, excluding rim cells
+ * @param height of the world, excluding rim cells
+ * @return Frame of width + 2 x height + 2 cells without alive cells
+ */
+Frame createFrame(int width, int height);
 }
 #endif //GAMEOFLIFE_TEST_TESTUTIL_H_
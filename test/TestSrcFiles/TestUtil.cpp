@@ -5,6 +5,9 @@
 
 #include "TestUtil.h"
 
+// Dimensions of the last game board created, excluding rim cells
+static Dimensions mapDimensions = {80, 24};
+
 //-------------------------------------------------------------------------------------
 /*
  * Creates a game board of wanted dimensions. Caller decides if rim cells is
@@ -16,8 +19,8 @@ void TestUtil::createMap(std::map<Point, Cell> &cells,
                          bool defineRimCells) {
 
     //Update world dimensions
-    WORLD_DIMENSIONS.HEIGHT = height;
-    WORLD_DIMENSIONS.WIDTH = width;
+    mapDimensions.HEIGHT = height;
+    mapDimensions.WIDTH = width;
 
 
     //Iterate through the world and create a new cell for each position
@@ -53,8 +56,8 @@ void TestUtil::printBoardlIsRimCell(std::map<Point, Cell> &cells) {
  */
 bool TestUtil::isPosRimCell(int row, int col) {
     //Check if position is around the boarders of the game board
-    return ((row == 0) || (row == WORLD_DIMENSIONS.HEIGHT + 1)
-        || (col == 0) || col == WORLD_DIMENSIONS.WIDTH + 1);
+    return ((row == 0) || (row == mapDimensions.HEIGHT + 1)
+        || (col == 0) || col == mapDimensions.WIDTH + 1);
 }
 
 /*
@@ -136,3 +139,18 @@ void TestUtil::setCellAliveNeighbours(map<Point, Cell> &cells,
 
 
 }
+
+//-------------------------------------------------------------------------------------
+/*
+ * Creates a frame where every cell, rim included, is dead
+ */
+Frame TestUtil::createFrame(int width, int height) {
+    Frame frame;
+    frame.generation = 0;
+    frame.width = width + 2;
+    frame.height = height + 2;
+    frame.values.assign(frame.width * frame.height, ' ');
+    frame.colors.assign(frame.width * frame.height, STATE_COLORS.DEAD);
+    frame.alive.assign(frame.width * frame.height, 0);
+    return frame;
+}
@@ -0,0 +1,72 @@
+/**
+ * @file test-Autotuner.cpp
+ * @author Group 11
+ * @brief This file contains test cases to test the class Autotuner
+ * @details These test cases will strive to ensure that a candidate is
+ * chosen, and that the choice is cached per rules and world size.
+ */
+
+#include <cstdio>
+#include <fstream>
+#include "Autotuner.h"
+#include "catch.hpp"
+
+//---------------------------------------------------------------------------
+/// @brief Tag used with CATCH to run test in this test file
+#define AUTOTUNER_TAG "[Autotuner]"
+
+/**
+ * @brief Tests choosing the threads and tile size
+ * @details Two thread counts and two tile sizes are tried for a random
+ * world, with a cache file of its own.
+ */
+SCENARIO("The threads and tile size are autotuned and cached", AUTOTUNER_TAG) {
+  GIVEN("an autotuner for a random 32x32 world using conway") {
+    std::remove("testAutotune.cache");
+    WorldSettings world;
+    world.dimensions = {32, 32};
+    world.randomFill.seed = 3;
+
+    Autotuner autotuner(world, "conway", "", "", "testAutotune.cache");
+    autotuner.setCandidates({1, 2}, {4, 8});
+
+    WHEN("it is tuned the first time") {
+      TuningChoice choice = autotuner.tune();
+
+      THEN("a candidate should be calibrated and chosen") {
+        REQUIRE(autotuner.wasCalibrated());
+        REQUIRE((choice.threads == 1 || choice.threads == 2));
+        REQUIRE((choice.tileSize == 4 || choice.tileSize == 8));
+      }
+
+      AND_WHEN("another autotuner is tuned for the same world") {
+        Autotuner again(world, "conway", "", "", "testAutotune.cache");
+        again.setCandidates({1, 2}, {4, 8});
+        TuningChoice cached = again.tune();
+
+        THEN("the cached choice should be used") {
+          REQUIRE_FALSE(again.wasCalibrated());
+          REQUIRE(cached.threads == choice.threads);
+          REQUIRE(cached.tileSize == choice.tileSize);
+        }
+      }
+
+      AND_WHEN("an autotuner is tuned for another world size and rule") {
+        world.dimensions = {16, 16};
+        Autotuner other(world, "von_neumann", "", "", "testAutotune.cache");
+        other.setCandidates({1}, {4});
+        other.tune();
+
+        THEN("it should be calibrated, and both choices kept") {
+          REQUIRE(other.wasCalibrated());
+          std::ifstream cache("testAutotune.cache");
+          std::string line;
+          int lines = 0;
+          while (std::getline(cache, line))
+            lines++;
+          REQUIRE(lines == 2);
+        }
+      }
+    }
+  }
+}
@@ -0,0 +1,77 @@
+/**
+ * @file test-CpuTopology.cpp
+ * @author Group 11
+ * @brief This file contains test cases to test the class CpuTopology
+ * @details These test cases will strive to ensure that CPU lists are read
+ * and that consecutive workers are placed on the same node.
+ */
+
+#include "Support/CpuTopology.h"
+#include "catch.hpp"
+
+//---------------------------------------------------------------------------
+/// @brief Tag used with CATCH to run test in this test file
+#define CPUTOPOLOGY_TAG "[CpuTopology]"
+
+/**
+ * @brief Test reading the CPU lists of the kernel
+ */
+SCENARIO("A CPU list is parsed", CPUTOPOLOGY_TAG) {
+  GIVEN("A list with ranges and single CPUs") {
+    WHEN("It is parsed") {
+      std::vector<int> cpus = CpuTopology::parseCpuList("0-2,5,8-9\n");
+      THEN("Every CPU should be read") {
+        REQUIRE(cpus == std::vector<int>({0, 1, 2, 5, 8, 9}));
+      }
+    }
+    WHEN("An empty list is parsed") {
+      THEN("No CPU should be read") {
+        REQUIRE(CpuTopology::parseCpuList("").empty());
+      }
+    }
+  }
+}
+
+/**
+ * @brief Test placing workers on the nodes
+ * @details Using two nodes with 4 and 2 CPUs, and a node without CPUs.
+ */
+SCENARIO("Workers are placed on the NUMA nodes", CPUTOPOLOGY_TAG) {
+  GIVEN("A topology with two nodes with CPUs") {
+    CpuTopology topology({{0, 1, 2, 3}, {}, {4, 5}});
+    REQUIRE(topology.getNodeCount() == 2);
+
+    WHEN("6 workers are placed") {
+      std::vector<WorkerPlacement> placements = topology.placeWorkers(6);
+      THEN("The workers should follow the CPUs, node by node") {
+        REQUIRE(placements.size() == 6);
+        for (int worker = 0; worker < 6; worker++) {
+          REQUIRE(placements[worker].cpu == worker);
+          REQUIRE(placements[worker].node == (worker < 4 ? 0 : 2));
+        }
+      }
+    }
+
+    WHEN("12 workers are placed") {
+      std::vector<WorkerPlacement> placements = topology.placeWorkers(12);
+      THEN("Consecutive workers should share a node and reuse its CPUs") {
+        REQUIRE(placements.size() == 12);
+        for (int worker = 0; worker < 12; worker++)
+          REQUIRE(placements[worker].node == (worker < 8 ? 0 : 2));
+        REQUIRE(placements[4].cpu == 0);
+        REQUIRE(placements[11].cpu == 5);
+      }
+    }
+  }
+
+  GIVEN("The topology of this machine") {
+    CpuTopology topology;
+    THEN("Every worker should be placed") {
+      REQUIRE(topology.getNodeCount() >= 1);
+      REQUIRE(topology.placeWorkers(3).size() == 3);
+    }
+    THEN("The CPU model should have a name") {
+      REQUIRE_FALSE(CpuTopology::readCpuModel().empty());
+    }
+  }
+}
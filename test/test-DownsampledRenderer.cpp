@@ -0,0 +1,93 @@
+/**
+ * @file test-DownsampledRenderer.cpp
+ * @author Group 11
+ * @brief This file contains test cases to test the class DownsampledRenderer
+ * @details These test cases will strive to ensure that each dot follows the
+ * cells it covers, for both Braille and half blocks, with and without zoom.
+ */
+
+#include "DownsampledRenderer.h"
+#include "catch.hpp"
+#include "TestUtil.h"
+
+//---------------------------------------------------------------------------
+/// @brief Tag used with CATCH to run test in this test file
+#define DOWNSAMPLEDRENDERER_TAG "[DownsampledRenderer]"
+
+/**
+ * @brief Tests rendering a frame as dots
+ * @details A 100x20 world, wider than one word of packed bits, with a few
+ * alive cells. World cell (column, row) is at frame position (column + 1,
+ * row + 1).
+ */
+SCENARIO("A frame is downsampled into dots", DOWNSAMPLEDRENDERER_TAG) {
+  GIVEN("a 100x20 world with alive cells") {
+    Frame frame = TestUtil::createFrame(100, 20);
+    frame.alive[frame.index(1, 1)] = 1;    // world 0,0
+    frame.alive[frame.index(2, 4)] = 1;    // world 1,3
+    frame.alive[frame.index(67, 2)] = 1;   // world 66,1
+
+    WHEN("it is rendered as Braille from the upper left") {
+      DownsampledRenderer renderer(DownsampleMode::BRAILLE, Viewport{0, 0, 1}, 40, 3);
+      const std::vector<uint32_t> &glyphs = renderer.render(frame);
+
+      THEN("each alive cell should light its dot") {
+        REQUIRE(glyphs.size() == 40 * 3);
+        REQUIRE(glyphs[0] == (0x2800 | 0x01 | 0x80));
+        REQUIRE(glyphs[33] == (0x2800 | 0x02));
+        REQUIRE(glyphs[1] == 0x2800);
+        REQUIRE(glyphs[40] == 0x2800);
+      }
+    }
+
+    WHEN("it is rendered as half blocks with an offset viewport") {
+      DownsampledRenderer renderer(DownsampleMode::HALF_BLOCKS, Viewport{66, 0, 1}, 10, 2);
+      const std::vector<uint32_t> &glyphs = renderer.render(frame);
+
+      THEN("the cell at the offset should be the lower half of the first character") {
+        REQUIRE(glyphs[0] == 0x2584);
+        REQUIRE(glyphs[1] == ' ');
+        REQUIRE(glyphs[10] == ' ');
+      }
+    }
+
+    WHEN("it is rendered outside of the world") {
+      DownsampledRenderer renderer(DownsampleMode::BRAILLE, Viewport{95, 15, 1}, 10, 5);
+      const std::vector<uint32_t> &glyphs = renderer.render(frame);
+
+      THEN("the dots outside the world should not be lit") {
+        for (uint32_t glyph : glyphs)
+          REQUIRE(glyph == 0x2800);
+      }
+    }
+
+    WHEN("it is rendered with a viewport starting before the world") {
+      DownsampledRenderer renderer(DownsampleMode::BRAILLE, Viewport{-2, -4, 1}, 10, 3);
+      const std::vector<uint32_t> &glyphs = renderer.render(frame);
+
+      THEN("the world should be shifted by the cells before it") {
+        REQUIRE(glyphs[0] == 0x2800);
+        REQUIRE(glyphs[10 + 1] == (0x2800 | 0x01 | 0x80));
+        REQUIRE(glyphs[10] == 0x2800);
+      }
+    }
+  }
+
+  GIVEN("a 16x16 world where a 4x4 block has 4 alive cells and another 3") {
+    Frame frame = TestUtil::createFrame(16, 16);
+    for (int cell = 0; cell < 4; cell++)
+      frame.alive[frame.index(1 + cell, 1 + cell)] = 1;
+    for (int cell = 0; cell < 3; cell++)
+      frame.alive[frame.index(5 + cell, 1)] = 1;
+
+    WHEN("it is rendered as half blocks with a zoom of 4") {
+      DownsampledRenderer renderer(DownsampleMode::HALF_BLOCKS, Viewport{0, 0, 4}, 4, 2);
+      const std::vector<uint32_t> &glyphs = renderer.render(frame);
+
+      THEN("only the dot with a quarter of its cells alive should be lit") {
+        REQUIRE(glyphs[0] == 0x2580);
+        REQUIRE(glyphs[1] == ' ');
+      }
+    }
+  }
+}
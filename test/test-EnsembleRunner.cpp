@@ -0,0 +1,68 @@
+/**
+ * @file test-EnsembleRunner.cpp
+ * @author Group 11
+ * @brief This file contains test cases to test the class EnsembleRunner
+ * @details These test cases will strive to ensure that the result of each
+ * seed only depends on the seed, and that stabilised worlds are recognised.
+ */
+
+#include "EnsembleRunner.h"
+#include "catch.hpp"
+
+//---------------------------------------------------------------------------
+/// @brief Tag used with CATCH to run test in this test file
+#define ENSEMBLERUNNER_TAG "[EnsembleRunner]"
+
+/**
+ * @brief Tests simulating an ensemble of seeds
+ * @details The same seeds are simulated by one and by three threads, every
+ * result should be the same and in seed order. A world without alive cells
+ * repeats itself directly.
+ */
+SCENARIO("An ensemble of seeds is simulated on a pool of threads", ENSEMBLERUNNER_TAG) {
+  GIVEN("random 24x16 worlds from seed 7 using conway") {
+    WorldSettings world;
+    world.dimensions = {24, 16};
+    world.randomFill.seed = 7;
+    world.randomFill.liveDensity = 0.3;
+
+    WHEN("five seeds are simulated by one and by three threads") {
+      vector<EnsembleResult> serial = EnsembleRunner(world, "conway", "", "", 200, 1).run(5);
+      vector<EnsembleResult> threaded = EnsembleRunner(world, "conway", "", "", 200, 3).run(5);
+
+      THEN("there should be one result per seed, in seed order") {
+        REQUIRE(serial.size() == 5);
+        for (size_t index = 0; index < serial.size(); index++)
+          REQUIRE(serial[index].seed == 7 + index);
+      }
+
+      THEN("the results should not depend on the threads") {
+        REQUIRE(threaded.size() == serial.size());
+        for (size_t index = 0; index < serial.size(); index++) {
+          REQUIRE(threaded[index].seed == serial[index].seed);
+          REQUIRE(threaded[index].stabilisationGeneration == serial[index].stabilisationGeneration);
+          REQUIRE(threaded[index].finalPopulation == serial[index].finalPopulation);
+          REQUIRE(threaded[index].period == serial[index].period);
+        }
+      }
+
+      THEN("a stabilised world should have a period") {
+        for (auto & result : serial)
+          REQUIRE((result.stabilisationGeneration >= 0) == (result.period > 0));
+      }
+    }
+
+    WHEN("worlds without alive cells are simulated") {
+      world.randomFill.liveDensity = 0.0;
+      vector<EnsembleResult> results = EnsembleRunner(world, "conway", "", "", 200, 2).run(2);
+
+      THEN("they should be still lifes from the first generation") {
+        for (auto & result : results) {
+          REQUIRE(result.stabilisationGeneration == 0);
+          REQUIRE(result.period == 1);
+          REQUIRE(result.finalPopulation == 0);
+        }
+      }
+    }
+  }
+}
@@ -0,0 +1,95 @@
+/**
+ * @file test-FrameRing.cpp
+ * @author Group 11
+ * @brief This file contains test cases to test the class FrameRing
+ * @details These test cases will strive to ensure that frames are passed in
+ * order, that old frames are dropped and that a full ring is not written.
+ */
+
+#include <thread>
+#include "Support/FrameRing.h"
+#include "catch.hpp"
+
+//---------------------------------------------------------------------------
+/// @brief Tag used with CATCH to run test in this test file
+#define FRAMERING_TAG "[FrameRing]"
+
+/**
+ * @brief Test publishing and acquiring frames on one thread
+ */
+SCENARIO("Frames are passed through a frame ring", FRAMERING_TAG) {
+  GIVEN("A ring with room for 3 frames") {
+    FrameRing ring(3);
+
+    WHEN("Nothing has been published") {
+      THEN("No frame should be acquired") {
+        REQUIRE(ring.acquireLatest() == nullptr);
+      }
+    }
+
+    WHEN("3 frames are published") {
+      for (int generation = 0; generation < 3; generation++) {
+        Frame *frame = ring.beginWrite();
+        REQUIRE(frame != nullptr);
+        frame->generation = generation;
+        ring.publish();
+      }
+
+      THEN("The ring should be full") {
+        REQUIRE(ring.beginWrite() == nullptr);
+        REQUIRE(ring.getSkippedFrames() == 1);
+      }
+      THEN("The newest frame should be acquired and the others dropped") {
+        const Frame *frame = ring.acquireLatest();
+        REQUIRE(frame != nullptr);
+        REQUIRE(frame->generation == 2);
+        REQUIRE(ring.getDroppedFrames() == 2);
+        ring.release();
+        REQUIRE(ring.acquireLatest() == nullptr);
+        REQUIRE(ring.beginWrite() != nullptr);
+      }
+    }
+  }
+}
+
+/**
+ * @brief Test passing frames between two threads
+ * @details The consumer should see the generations in increasing order and
+ * always get the last frame.
+ */
+SCENARIO("Frames are passed between two threads", FRAMERING_TAG) {
+  GIVEN("A producer publishing 10000 frames") {
+    FrameRing ring(4);
+    std::thread producer([&ring] {
+      for (int generation = 0; generation < 10000; generation++) {
+        Frame *frame = ring.beginWrite();
+        while (frame == nullptr && generation == 9999) {
+          std::this_thread::yield();
+          frame = ring.beginWrite();
+        }
+        if (frame == nullptr)
+          continue;
+        frame->generation = generation;
+        ring.publish();
+      }
+    });
+
+    WHEN("The consumer reads until the last frame") {
+      int last = -1;
+      bool increasing = true;
+      while (last != 9999) {
+        const Frame *frame = ring.acquireLatest();
+        if (frame == nullptr)
+          continue;
+        increasing = increasing && frame->generation > last;
+        last = frame->generation;
+        ring.release();
+      }
+      producer.join();
+
+      THEN("The generations should be increasing") {
+        REQUIRE(increasing);
+      }
+    }
+  }
+}
@@ -0,0 +1,123 @@
+/**
+ * @file test-FrameStreamer.cpp
+ * @author Group 11
+ * @brief This file contains test cases to test the class FrameStreamer
+ * @details These test cases will strive to ensure that the header and the
+ * pixels of the frames are streamed, both to a file and to a pipe.
+ */
+
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <thread>
+#include <unistd.h>
+#include "FrameStreamer.h"
+#include "catch.hpp"
+#include "TestUtil.h"
+
+//---------------------------------------------------------------------------
+/// @brief Tag used with CATCH to run test in this test file
+#define FRAMESTREAMER_TAG "[FrameStreamer]"
+
+/**
+ * @brief Reads a number stored as four bytes, least significant first
+ * @param bytes the bytes
+ * @param position index of the first byte
+ * @return unsigned int the number
+ */
+static unsigned int readLittleEndian(const std::string &bytes, size_t position) {
+  unsigned int value = 0;
+  for (size_t index = 4; index > 0; index--)
+    value = (value << 8) | static_cast<unsigned char>(bytes[position + index - 1]);
+  return value;
+}
+
+/**
+ * @brief Tests the header of a stream
+ */
+SCENARIO("The header of a stream describes the frames", FRAMESTREAMER_TAG) {
+  GIVEN("the header of 40x3 RGB frames at 25 frames per second") {
+    std::string header = FrameStreamer::makeHeader(40, 3, PixelFormat::RGB, 25.0);
+
+    THEN("it should hold the size, rate, format and palette") {
+      REQUIRE(header.size() == STREAM_HEADER_SIZE);
+      REQUIRE(header.compare(0, 8, "GOLRAW01") == 0);
+      REQUIRE(readLittleEndian(header, 8) == 40);
+      REQUIRE(readLittleEndian(header, 12) == 3);
+      REQUIRE(readLittleEndian(header, 16) == 25000);
+      REQUIRE(readLittleEndian(header, 20) == 1000);
+      REQUIRE(readLittleEndian(header, 24) == 0);
+      REQUIRE(readLittleEndian(header, 28) == 40 * 3 * 3);
+      REQUIRE(static_cast<unsigned char>(header[32 + 7 * 3]) == COLOR_RGB[7][0]);
+    }
+  }
+}
+
+/**
+ * @brief Tests streaming frames to a file and to a pipe
+ * @details A 40x3 world with one living cell, streamed twice.
+ */
+SCENARIO("Frames are streamed as raw pixels", FRAMESTREAMER_TAG) {
+  GIVEN("a 40x3 frame with one living cell") {
+    Frame frame = TestUtil::createFrame(40, 3);
+    frame.colors[frame.index(2, 1)] = STATE_COLORS.LIVING;
+
+    WHEN("it is streamed twice to a file as palette indexes") {
+      std::string fileName = "test_stream.raw";
+      {
+        FrameStreamer streamer(fileName, PixelFormat::PALETTE, 0.0);
+        streamer.writeFrame(frame);
+        streamer.writeFrame(frame);
+        REQUIRE(streamer.getStats().frames == 2);
+        REQUIRE_FALSE(streamer.getStats().spliced);
+      }
+      std::ifstream file(fileName, std::ios::binary);
+      std::string bytes((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+      file.close();
+      std::remove(fileName.c_str());
+
+      THEN("the header should be followed by one byte per cell of each frame") {
+        REQUIRE(bytes.size() == STREAM_HEADER_SIZE + 2 * 40 * 3);
+        REQUIRE(readLittleEndian(bytes, 16) == DEFAULT_STREAM_FPS * 1000);
+        REQUIRE(bytes[STREAM_HEADER_SIZE] == 0);
+        REQUIRE(bytes[STREAM_HEADER_SIZE + 1] == 7);
+        REQUIRE(bytes[STREAM_HEADER_SIZE + 40 * 3 + 1] == 7);
+      }
+    }
+
+#ifdef __linux__
+    WHEN("it is streamed as RGB to a pipe that is read by another thread") {
+      int ends[2];
+      REQUIRE(pipe(ends) == 0);
+      std::string bytes;
+      std::thread reader([&bytes, &ends] {
+        char chunk[4096];
+        ssize_t length;
+        while ((length = read(ends[0], chunk, sizeof(chunk))) > 0)
+          bytes.append(chunk, static_cast<size_t>(length));
+      });
+
+      StreamStats stats;
+      {
+        FrameStreamer streamer("/dev/fd/" + std::to_string(ends[1]), PixelFormat::RGB, 10.0);
+        close(ends[1]);
+        for (int frames = 0; frames < 100; frames++)
+          streamer.writeFrame(frame);
+        stats = streamer.getStats();
+      }
+      reader.join();
+      close(ends[0]);
+
+      THEN("the pages should be given to the pipe, and read in order") {
+        REQUIRE(stats.spliced);
+        REQUIRE(stats.frames == 100);
+        REQUIRE(bytes.size() == STREAM_HEADER_SIZE + 100 * 40 * 3 * 3);
+        size_t last = STREAM_HEADER_SIZE + 99 * 40 * 3 * 3;
+        REQUIRE(static_cast<unsigned char>(bytes[last + 3]) == COLOR_RGB[7][0]);
+        REQUIRE(bytes[last + 6] == 0);
+      }
+    }
+#endif
+  }
+}
@@ -9,7 +9,11 @@
  *
  */
 
+#include <chrono>
+#include <cstdio>
+#include <fstream>
 #include <iostream>
+#include <iterator>
 #include "../include/GameOfLife.h"
 #include "catch.hpp"
 
@@ -77,3 +81,131 @@ SCENARIO("Running the simulation with valid input values.", GAMEOFLIFE_TAG) {
     }
   }
 }
+
+SCENARIO("Pulling the generations of the simulation as a stream.", GAMEOFLIFE_TAG) {
+  GIVEN("A GameOfLife object initialized with 5 generations") {
+    GameOfLife testGame(5, "conway", "conway");
+    WHEN("Every generation of the stream is pulled") {
+      int pulled = 0;
+      for (const GenerationView& view : testGame.generations())
+        pulled += (view.getGeneration() == pulled) ? 1 : 0;
+      THEN("The stream should end at the last generation") {
+        REQUIRE(pulled == 5);
+        REQUIRE(testGame.getPopulation().getGeneration() == 5);
+      }
+    }
+  }
+}
+
+SCENARIO("Running the simulation without presenting it.", GAMEOFLIFE_TAG) {
+  GIVEN("A headless GameOfLife and a Population with the same world") {
+    WorldSettings world;
+    world.dimensions = {30, 20};
+    world.randomFill.seed = 5;
+    GameOfLife testGame(20, "conway", "conway", "", world);
+    Population stepped;
+    stepped.setWorld(world);
+    stepped.initiatePopulation("conway", "conway");
+
+    WHEN("Every generation is calculated") {
+      HeadlessStats stats = testGame.runHeadless();
+      while (stepped.getGeneration() < 20)
+        stepped.calculateNewGeneration();
+      Frame frame;
+      stepped.takeSnapshot(frame);
+
+      THEN("The rates should count every cell of every generation") {
+        REQUIRE(stats.generations == 20);
+        REQUIRE(stats.cellUpdates == 20ULL * 30 * 20);
+      }
+      THEN("The checksum should be the same as when stepping") {
+        REQUIRE(stats.checksum == frame.aliveChecksum());
+        int alive = 0;
+        for (unsigned char cell : frame.alive)
+          alive += cell;
+        REQUIRE(stats.population == alive);
+      }
+    }
+  }
+  GIVEN("A headless GameOfLife of 21 generations, two per sweep") {
+    WorldSettings world;
+    world.dimensions = {30, 20};
+    world.randomFill.seed = 5;
+    GameOfLife testGame(21, "conway", "conway", "", world);
+    testGame.getPopulation().setGenerationsPerSweep(2);
+    Population stepped;
+    stepped.setWorld(world);
+    stepped.initiatePopulation("conway", "conway");
+
+    WHEN("Every generation is calculated") {
+      HeadlessStats stats = testGame.runHeadless();
+      while (stepped.getGeneration() < 21)
+        stepped.calculateNewGeneration();
+      Frame frame;
+      stepped.takeSnapshot(frame);
+
+      THEN("The last generation should be calculated on its own") {
+        REQUIRE(stats.generations == 21);
+        REQUIRE(testGame.getPopulation().getGeneration() == 21);
+        REQUIRE(testGame.getPopulation().getGenerationsPerSweep() == 2);
+        REQUIRE(stats.checksum == frame.aliveChecksum());
+      }
+    }
+  }
+}
+
+SCENARIO("Pacing the generations of the simulation.", GAMEOFLIFE_TAG) {
+  GIVEN("A GameOfLife of 10 generations paced to 200 generations per second") {
+    GameOfLife testGame(10, "conway", "conway");
+    testGame.setPacing(0.0, 200.0);
+    WHEN("The simulation is run") {
+      std::stringstream buffer;
+      std::streambuf* old = std::cout.rdbuf(buffer.rdbuf());
+      auto start = std::chrono::steady_clock::now();
+      testGame.runSimulation();
+      double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+      std::cout.rdbuf(old);
+      THEN("The generations should follow their deadlines") {
+        REQUIRE(seconds >= 0.04);
+        REQUIRE(testGame.getPacingStats().generationsPerSecond > 0.0);
+        REQUIRE(testGame.getPacingStats().generationsPerSecond < 230.0);
+        REQUIRE(testGame.getPacingStats().framesPerSecond > 0.0);
+      }
+    }
+  }
+}
+
+SCENARIO("The first generation of the simulation is always shown.", GAMEOFLIFE_TAG) {
+  GIVEN("A GameOfLife streaming palette frames to a file, and a Population with the same world") {
+    WorldSettings world;
+    world.dimensions = {30, 20};
+    world.randomFill.seed = 9;
+    GameOfLife testGame(40, "conway", "conway", "", world);
+    Population first;
+    first.setWorld(world);
+    first.initiatePopulation("conway", "conway");
+    Frame frame;
+    first.takeSnapshot(frame);
+
+    WHEN("The simulation is run") {
+      std::string fileName = "test_first_generation.raw";
+      {
+        FrameStreamer streamer(fileName, PixelFormat::PALETTE, 0.0);
+        testGame.setStreamer(&streamer);
+        testGame.runSimulation();
+      }
+      std::ifstream file(fileName, std::ios::binary);
+      std::string bytes((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+      file.close();
+      std::remove(fileName.c_str());
+
+      THEN("The first streamed frame should be generation zero") {
+        REQUIRE(bytes.size() >= static_cast<size_t>(STREAM_HEADER_SIZE + 30 * 20));
+        for (int row = 1; row <= 20; row++)
+          for (int column = 1; column <= 30; column++)
+            REQUIRE(static_cast<unsigned char>(bytes[STREAM_HEADER_SIZE + (row - 1) * 30 + column - 1]) ==
+                    paletteIndex(frame.colors[frame.index(column, row)]));
+      }
+    }
+  }
+}
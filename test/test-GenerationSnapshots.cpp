@@ -0,0 +1,121 @@
+/**
+ * @file test-GenerationSnapshots.cpp
+ * @author Group 11
+ * @brief This file contains test cases to test the class GenerationSnapshots
+ * @details These test cases will strive to ensure that pinned buffers are
+ * never reused and that released buffers are.
+ */
+
+#include <thread>
+#include "Support/GenerationSnapshots.h"
+#include "catch.hpp"
+
+//---------------------------------------------------------------------------
+/// @brief Tag used with CATCH to run test in this test file
+#define SNAPSHOTS_TAG "[GenerationSnapshots]"
+
+/**
+ * @brief Writes a generation into the snapshots
+ * @param snapshots the snapshots to publish to
+ * @param generation number of the generation
+ * @return bool if the generation was published
+ */
+static bool publishGeneration(GenerationSnapshots &snapshots, int generation) {
+  Frame *frame = snapshots.beginWrite();
+  if (frame == nullptr)
+    return false;
+  frame->generation = generation;
+  frame->values.assign(4, static_cast<char>('0' + generation % 10));
+  snapshots.publish();
+  return true;
+}
+
+/**
+ * @brief Test pinning and releasing generations on one thread
+ */
+SCENARIO("Generations are pinned by readers", SNAPSHOTS_TAG) {
+  GIVEN("Snapshots with 3 buffers") {
+    GenerationSnapshots snapshots(3);
+
+    WHEN("Nothing has been published") {
+      THEN("Nothing should be pinned") {
+        REQUIRE_FALSE(snapshots.pin());
+      }
+    }
+
+    WHEN("A generation is pinned while later ones are published") {
+      publishGeneration(snapshots, 1);
+      PinnedFrame first = snapshots.pin();
+      for (int generation = 2; generation <= 10; generation++)
+        publishGeneration(snapshots, generation);
+
+      THEN("The pinned generation should be unchanged") {
+        REQUIRE(first->generation == 1);
+        REQUIRE(first->values[0] == '1');
+        REQUIRE(snapshots.getSkippedGenerations() == 0);
+      }
+      THEN("The newest generation should be pinned next") {
+        REQUIRE(snapshots.pin()->generation == 10);
+      }
+    }
+
+    WHEN("Every buffer but the current one is pinned") {
+      publishGeneration(snapshots, 1);
+      PinnedFrame first = snapshots.pin();
+      publishGeneration(snapshots, 2);
+      PinnedFrame second = snapshots.pin();
+      publishGeneration(snapshots, 3);
+
+      THEN("The next generation should be skipped") {
+        REQUIRE_FALSE(publishGeneration(snapshots, 4));
+        REQUIRE(snapshots.getSkippedGenerations() == 1);
+        REQUIRE(snapshots.pin()->generation == 3);
+      }
+      THEN("The generation should be published once a buffer is released") {
+        PinnedFrame moved = std::move(first);
+        REQUIRE_FALSE(first);
+        moved.release();
+        REQUIRE(publishGeneration(snapshots, 4));
+        REQUIRE(second->generation == 2);
+        REQUIRE(snapshots.pin()->generation == 4);
+      }
+    }
+  }
+}
+
+/**
+ * @brief Test readers pinning generations while another thread publishes
+ */
+SCENARIO("Generations are pinned from other threads", SNAPSHOTS_TAG) {
+  GIVEN("Snapshots with 4 buffers and a publishing thread") {
+    GenerationSnapshots snapshots(4);
+    publishGeneration(snapshots, 0);
+
+    WHEN("Readers pin generations while they are published") {
+      const int generations = 2000;
+      std::thread writer([&snapshots]() {
+        for (int generation = 1; generation <= generations; generation++)
+          publishGeneration(snapshots, generation);
+      });
+
+      bool consistent = true;
+      bool ordered = true;
+      int last = 0;
+      while (last < generations) {
+        PinnedFrame pinned = snapshots.pin();
+        int generation = pinned->generation;
+        ordered = ordered && generation >= last;
+        last = generation;
+        for (char value : pinned->values)
+          consistent = consistent && value == '0' + generation % 10;
+      }
+      writer.join();
+
+      THEN("A pinned generation should never be written to") {
+        REQUIRE(consistent);
+        REQUIRE(ordered);
+      }
+    }
+  }
+}
+//---------------------------------------------------------------------------
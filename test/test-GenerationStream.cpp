@@ -0,0 +1,86 @@
+/**
+ * @file test-GenerationStream.cpp
+ * @author Group 11
+ * @brief This file contains test cases to test the class GenerationStream
+ * @details These test cases will strive to ensure that the generations are
+ * given in order, only when pulled, and that skipping and the coroutine
+ * generator gives the same cells as stepping.
+ */
+
+#include <vector>
+#include "GenerationStream.h"
+#include "catch.hpp"
+
+//---------------------------------------------------------------------------
+/// @brief Tag used with CATCH to run test in this test file
+#define GENERATIONSTREAM_TAG "[GenerationStream]"
+
+/**
+ * @brief Tests pulling generations from a stream
+ * @details Populations with the same random 20x20 world are stepped, skipped
+ * and generated. Every way should end with the same cells.
+ */
+SCENARIO("Generations are pulled from a stream", GENERATIONSTREAM_TAG) {
+  GIVEN("two populations with the same random world using conway") {
+    WorldSettings world;
+    world.dimensions = {20, 20};
+    world.randomFill.seed = 11;
+    Population stepped, other;
+    stepped.setWorld(world);
+    other.setWorld(world);
+    stepped.initiatePopulation("conway");
+    other.initiatePopulation("conway");
+
+    WHEN("the first population is stepped through a stream of 10 generations") {
+      GenerationStream stream(stepped, 10);
+      std::vector<int> generations;
+      for (const GenerationView &view : stream)
+        generations.push_back(view.getGeneration());
+
+      THEN("every generation before the last should be given, in order") {
+        REQUIRE(generations.size() == 10);
+        for (int generation = 0; generation < 10; generation++)
+          REQUIRE(generations[generation] == generation);
+        REQUIRE(stream.begin() == stream.end());
+      }
+
+      AND_WHEN("the second population skips the same generations") {
+        GenerationStream skipping(other, 10);
+        GenerationView view = skipping.skip(100);
+
+        THEN("it should stop at the last generation with the same cells") {
+          REQUIRE(view.getGeneration() == 10);
+          Frame expected, actual;
+          stepped.takeSnapshot(expected);
+          view.takeSnapshot(actual);
+          REQUIRE(actual.alive == expected.alive);
+        }
+      }
+
+#ifdef GAMEOFLIFE_HAS_COROUTINES
+      AND_WHEN("the second population is generated by the coroutine") {
+        int given = 0;
+        for (const GenerationView &view : generateGenerations(other, 10))
+          REQUIRE(view.getGeneration() == given++);
+
+        THEN("the same generations and cells should be given") {
+          REQUIRE(given == 10);
+          Frame expected, actual;
+          stepped.takeSnapshot(expected);
+          other.takeSnapshot(actual);
+          REQUIRE(actual.alive == expected.alive);
+        }
+      }
+#endif
+    }
+
+    WHEN("the stream is not pulled") {
+      GenerationStream stream(stepped, 10);
+      GenerationView view = *stream.begin();
+
+      THEN("no generation should be calculated") {
+        REQUIRE(view.getGeneration() == 0);
+      }
+    }
+  }
+}
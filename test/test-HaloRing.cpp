@@ -0,0 +1,51 @@
+/**
+ * @file test-HaloRing.cpp
+ * @author Group 11
+ * @brief This file contains test cases to test the class HaloRing
+ * @details These test cases will strive to ensure that rows are passed in
+ * order, and that a waiting process is stopped by the abort flag.
+ */
+
+#include <ios>
+#include <vector>
+#include "Support/HaloRing.h"
+#include "catch.hpp"
+
+//---------------------------------------------------------------------------
+/// @brief Tag used with CATCH to run test in this test file
+#define HALORING_TAG "[HaloRing]"
+
+/**
+ * @brief Test pushing and popping rows in one process
+ * @details The ring is placed in an ordinary block of memory.
+ */
+SCENARIO("Rows are passed through a halo ring", HALORING_TAG) {
+  GIVEN("A ring with room for 2 rows of 3 cells") {
+    std::vector<long long> memory(HaloRing::getSize(3, 2) / sizeof(long long) + 1);
+    std::atomic<int> aborted(0);
+    HaloRing ring(memory.data(), 3, 2, &aborted);
+
+    WHEN("2 rows are pushed and popped") {
+      std::vector<Cell> first(3, Cell(false, GIVE_CELL_LIFE));
+      std::vector<Cell> second(3, Cell(false, KILL_CELL));
+      ring.push(first.data());
+      ring.push(second.data());
+
+      std::vector<Cell> row(3);
+      ring.pop(row.data());
+      THEN("The first row should be popped first") {
+        REQUIRE(row[2].isAlive());
+        ring.pop(row.data());
+        REQUIRE_FALSE(row[0].isAlive());
+      }
+    }
+
+    WHEN("A row is popped from an empty ring after an abort") {
+      aborted = 1;
+      std::vector<Cell> row(3);
+      THEN("The waiting should be stopped") {
+        REQUIRE_THROWS_AS(ring.pop(row.data()), std::ios_base::failure);
+      }
+    }
+  }
+}
@@ -0,0 +1,122 @@
+/**
+ * @file test-ImageExporter.cpp
+ * @author Group 11
+ * @brief This file contains test cases to test the class ImageExporter
+ * @details These test cases will strive to ensure that the images follow the
+ * colors of the cells, and that the exporter writes every Nth generation.
+ */
+
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <sys/stat.h>
+#include "GameOfLife.h"
+#include "ImageExporter.h"
+#include "catch.hpp"
+#include "TestUtil.h"
+
+//---------------------------------------------------------------------------
+/// @brief Tag used with CATCH to run test in this test file
+#define IMAGEEXPORTER_TAG "[ImageExporter]"
+
+/**
+ * @brief Reads a number stored as four bytes, most significant first
+ * @param bytes the bytes
+ * @param position index of the first byte
+ * @return unsigned int the number
+ */
+static unsigned int readBigEndian(const std::string &bytes, size_t position) {
+  unsigned int value = 0;
+  for (size_t index = 0; index < 4; index++)
+    value = (value << 8) | static_cast<unsigned char>(bytes[position + index]);
+  return value;
+}
+
+/**
+ * @brief Tests encoding a frame as PPM and PNG
+ * @details A 40x3 world with one alive cell, at world cell (1, 0).
+ */
+SCENARIO("A frame is encoded as an image", IMAGEEXPORTER_TAG) {
+  GIVEN("a 40x3 frame with one living cell") {
+    Frame frame = TestUtil::createFrame(40, 3);
+    frame.colors[frame.index(2, 1)] = STATE_COLORS.LIVING;
+    std::string bytes;
+
+    WHEN("it is encoded as PPM") {
+      ImageExporter::encodePpm(frame, bytes);
+      std::string header = "P6\n40 3\n255\n";
+
+      THEN("there should be one pixel per cell, with the color of the cell") {
+        REQUIRE(bytes.compare(0, header.size(), header) == 0);
+        REQUIRE(bytes.size() == header.size() + 40 * 3 * 3);
+        REQUIRE(bytes[header.size()] == 0);
+        REQUIRE(static_cast<unsigned char>(bytes[header.size() + 3]) == 229);
+        REQUIRE(bytes[header.size() + 6] == 0);
+      }
+    }
+
+    WHEN("it is encoded as PNG") {
+      ImageExporter::encodePng(frame, bytes);
+
+      THEN("it should start with the signature and the size") {
+        REQUIRE(bytes.compare(0, 8, "\x89PNG\r\n\x1A\n") == 0);
+        REQUIRE(bytes.compare(12, 4, "IHDR") == 0);
+        REQUIRE(readBigEndian(bytes, 16) == 40);
+        REQUIRE(readBigEndian(bytes, 20) == 3);
+      }
+
+      THEN("it should end with the end chunk") {
+        REQUIRE(bytes.compare(bytes.size() - 8, 4, "IEND") == 0);
+      }
+
+      THEN("the rows of dead cells should be compressed") {
+        size_t idat = bytes.find("IDAT");
+        REQUIRE(idat != std::string::npos);
+        REQUIRE(readBigEndian(bytes, idat - 4) < 41 * 3);
+      }
+    }
+  }
+}
+
+/**
+ * @brief Tests exporting the generations of a headless run
+ * @details The images are written to a directory created by the test, and
+ * removed afterwards.
+ */
+SCENARIO("The generations of a run are exported", IMAGEEXPORTER_TAG) {
+  GIVEN("a headless GameOfLife of 6 generations and an exporter for every second generation") {
+    std::string directory = "test_export";
+    mkdir(directory.c_str(), 0755);
+    WorldSettings world;
+    world.dimensions = {20, 10};
+    world.randomFill.seed = 3;
+    GameOfLife testGame(6, "conway", "conway", "", world);
+
+    WHEN("the simulation is run") {
+      ImageExporter exporter(directory, 2, ImageFormat::PPM, 2, 8);
+      testGame.setExporter(&exporter);
+      testGame.runHeadless();
+      ExportStats stats = exporter.finish();
+
+      THEN("one image should be written for every second generation") {
+        REQUIRE(stats.written == 4);
+        REQUIRE(stats.dropped == 0);
+        for (int generation = 0; generation <= 6; generation += 2) {
+          std::string fileName = directory + "/generation_00000" + std::to_string(generation) + ".ppm";
+          std::ifstream file(fileName, std::ios::binary);
+          REQUIRE(file.good());
+          file.close();
+          std::remove(fileName.c_str());
+        }
+      }
+    }
+    rmdir(directory.c_str());
+  }
+
+  GIVEN("a directory that does not exist") {
+    THEN("the exporter should not be created") {
+      REQUIRE_THROWS_AS(ImageExporter("no_such_directory", 1, ImageFormat::PPM),
+                        std::ios_base::failure);
+    }
+  }
+}
@@ -124,25 +124,20 @@ SCENARIO("Test the WorldsizeArgument Constructor and Public funtions",
     THEN("The function getValue should return the correct argValue '-s'") {
       REQUIRE(WorldsizeTest.getValue() == "-s");
     }
-    // Save the previously stored values.
-    Dimensions oldDimensions;
-    oldDimensions.HEIGHT = WORLD_DIMENSIONS.HEIGHT;
-    oldDimensions.WIDTH = WORLD_DIMENSIONS.WIDTH;
-
     WHEN("The function execute() is called and given an argument value") {
       ApplicationValues appValues;
       char* dimensions = "20x24";
       WorldsizeTest.execute(appValues, dimensions);
       THEN(
-          "The global variable WORLD_DIMENSIONS.WIDTH should be set to the "
+          "The appValue world.dimensions.WIDTH should be set to the "
           "given value "
           "20") {
-        REQUIRE(WORLD_DIMENSIONS.WIDTH == 20);
+        REQUIRE(appValues.world.dimensions.WIDTH == 20);
         THEN(
-            "The global variable WORLD_DIMENSIONS.HEIGHT should be set to "
+            "The appValue world.dimensions.HEIGHT should be set to "
             "the "
             "given value 24") {
-          REQUIRE(WORLD_DIMENSIONS.HEIGHT == 24);
+          REQUIRE(appValues.world.dimensions.HEIGHT == 24);
         }
       }
     }
@@ -166,9 +161,6 @@ SCENARIO("Test the WorldsizeArgument Constructor and Public funtions",
         REQUIRE_FALSE(appValues.runSimulation);
       }
     }
-    // restore the old values to isolate the test case changes.
-    WORLD_DIMENSIONS.HEIGHT = oldDimensions.HEIGHT;
-    WORLD_DIMENSIONS.WIDTH = oldDimensions.WIDTH;
   }
 }
 //---------------------------------------------------------------------------
@@ -179,8 +171,6 @@ SCENARIO("Test the WorldsizeArgument Constructor and Public funtions",
  */
 SCENARIO("Test the FileArgument Constructor and public functions",
          MAINARGUMENTS_TAG) {
-  // save the old value
-  std::string oldFile = fileName;
   GIVEN("An object of the derived class FileArgument") {
     FileArgument FileArgTest;
     THEN("The function getValue() should return the correct argValue '-f'") {
@@ -190,8 +180,8 @@ SCENARIO("Test the FileArgument Constructor and public functions",
       ApplicationValues appValues;
       char* fileNameArg = "Population_Seed.txt";
       FileArgTest.execute(appValues, fileNameArg);
-      THEN("The global variable fileName should be set to fileNameArg")
-      CHECK(fileName == "Population_Seed.txt");
+      THEN("The appValue world.fileName should be set to fileNameArg")
+      CHECK(appValues.world.fileName == "Population_Seed.txt");
     }
     WHEN("The function Execute() is called and given an no value") {
       ApplicationValues appValues;
@@ -204,8 +194,6 @@ SCENARIO("Test the FileArgument Constructor and public functions",
       }
     }
   }
-  // restore the old value after test changes.
-  fileName = oldFile;
 }
 //---------------------------------------------------------------------------
 /**
@@ -273,3 +261,75 @@ SCENARIO("Test the OddRuleArgument Constructor and public functions",
   }
 }
 //---------------------------------------------------------------------------
+/**
+ * @brief Test RuleMapArgument constructor and public functions
+ * @details This scenario will test the abstract constructor, getvalue and
+ * execute functions for the derived class RuleMapArgument
+ */
+SCENARIO("Test the RuleMapArgument Constructor and public functions",
+         MAINARGUMENTS_TAG) {
+  RuleMapArgument ruleMapTest;
+  GIVEN("An object of the derived class RuleMapArgument") {
+    THEN("The function getValue() should return the correct argValue '-rm'") {
+      REQUIRE(ruleMapTest.getValue() == "-rm");
+    }
+    WHEN("The function execute() is called and given an argument value") {
+      ApplicationValues appValues;
+      char ruleMapFile[] = "rules.txt";
+      ruleMapTest.execute(appValues, ruleMapFile);
+      THEN("The ruleMapFileName variable should be set to the value") {
+        REQUIRE(appValues.ruleMapFileName == "rules.txt");
+      }
+    }
+    WHEN("The function execute() is called and given no value") {
+      ApplicationValues appValues;
+      std::stringstream buffer;
+      std::streambuf* old = std::cout.rdbuf(buffer.rdbuf());
+      ruleMapTest.execute(appValues, nullptr);
+      std::cout.rdbuf(old);
+      THEN("runsimulation should be set to false") {
+        REQUIRE_FALSE(appValues.runSimulation);
+      }
+    }
+  }
+}
+//---------------------------------------------------------------------------
+/**
+ * @brief Test ViewportArgument constructor and public functions
+ * @details This scenario will test the abstract constructor, getvalue and
+ * execute functions for the derived class ViewportArgument
+ */
+SCENARIO("Test the ViewportArgument Constructor and public functions",
+         MAINARGUMENTS_TAG) {
+  ViewportArgument viewportTest;
+  GIVEN("An object of the derived class ViewportArgument") {
+    THEN("The function getValue() should return the correct argValue '-vp'") {
+      REQUIRE(viewportTest.getValue() == "-vp");
+    }
+    WHEN("The function execute() is called and given a column and row") {
+      ApplicationValues appValues;
+      char corner[] = "12x7";
+      viewportTest.execute(appValues, corner);
+      THEN("The viewport should start at the column and row") {
+        REQUIRE(appValues.viewport.column == 12);
+        REQUIRE(appValues.viewport.row == 7);
+        REQUIRE(appValues.runSimulation);
+      }
+    }
+    WHEN("The function execute() is called with a negative or non numeric value") {
+      std::stringstream buffer;
+      std::streambuf* old = std::cout.rdbuf(buffer.rdbuf());
+      ApplicationValues negative, text;
+      char negativeCorner[] = "-10x-10";
+      char textCorner[] = "axb";
+      viewportTest.execute(negative, negativeCorner);
+      viewportTest.execute(text, textCorner);
+      std::cout.rdbuf(old);
+      THEN("runsimulation should be set to false") {
+        REQUIRE_FALSE(negative.runSimulation);
+        REQUIRE_FALSE(text.runSimulation);
+      }
+    }
+  }
+}
+//---------------------------------------------------------------------------
@@ -18,19 +18,12 @@
 /**
  * @brief The Parser manipulates application values.
  * @details This test scenario will use a MainArgumentsParser object to
- * manipulate application values in an ApplicationValues Struct. As global
- * variables exist, the default values of these are saved to be restored later,
- * as otherwise they can interfere with subsequent testing. The test scenarios
- * should be "isolated".
+ * manipulate application values in an ApplicationValues Struct.
  */
 SCENARIO(
     "A MainArgumentsParser is created and used to set valid application "
     "values",
     PARSER_TAG) {
-  // save old global variable values:
-  Dimensions oldDimensions = WORLD_DIMENSIONS;
-  std::string oldFile = fileName;
-
   GIVEN("A MainArgumentsParser object") {
     MainArgumentsParser testParser;
     WHEN(
@@ -50,17 +43,17 @@ SCENARIO(
         REQUIRE(testValues.maxGenerations == 20);
       }
       THEN(
-          "After parsing '-s' '20x40' the lobal variable WORLD_DIMENSIONS "
+          "After parsing '-s' '20x40' the variable world.dimensions "
           "should be set "
           "correcly") {
-        CHECK(WORLD_DIMENSIONS.WIDTH == 20);
+        CHECK(testValues.world.dimensions.WIDTH == 20);
 
-        CHECK(WORLD_DIMENSIONS.HEIGHT == 40);
+        CHECK(testValues.world.dimensions.HEIGHT == 40);
       }
       THEN(
-          "After parsing '-f' 'Population_Seed.txt' theGlobal Variable "
-          "fileName should be correcly set") {
-        REQUIRE(fileName == "Population_Seed.txt");
+          "After parsing '-f' 'Population_Seed.txt' the variable "
+          "world.fileName should be correcly set") {
+        REQUIRE(testValues.world.fileName == "Population_Seed.txt");
       }
       THEN("After parsing '-er' 'eric' evenRuleName should be correctly set") {
         REQUIRE(testValues.evenRuleName == "eric");
@@ -70,9 +63,6 @@ SCENARIO(
       }
     }
   }
-  // restore old values to isolate the changes from the test to the test case.
-  WORLD_DIMENSIONS = oldDimensions;
-  fileName = oldFile;
 }
 
 /**
@@ -83,10 +73,6 @@ SCENARIO(
  */
 SCENARIO("A MainArgumentsParser is created given no extra arguments to parse",
          PARSER_TAG) {
-  // save old global variable values:
-  Dimensions oldDimensions = WORLD_DIMENSIONS;
-  std::string oldFile = fileName;
-
   GIVEN("A MainArgumentsParser object and Default application Values") {
     ApplicationValues defaultValues;
     MainArgumentsParser testDefaultParser;
@@ -98,20 +84,20 @@ SCENARIO("A MainArgumentsParser is created given no extra arguments to parse",
       ApplicationValues testValues =
           testDefaultParser.runParser(testArgv, testArgc);
       THEN(
-          "Application Values and Global Variables should be default values.") {
+          "Application Values should be default values.") {
         CHECK(testValues.maxGenerations == defaultValues.maxGenerations);
 
-        CHECK(WORLD_DIMENSIONS.HEIGHT == oldDimensions.HEIGHT);
-        CHECK(WORLD_DIMENSIONS.WIDTH == oldDimensions.WIDTH);
-        CHECK(fileName == oldFile);
+        CHECK(testValues.world.dimensions.HEIGHT ==
+              defaultValues.world.dimensions.HEIGHT);
+        CHECK(testValues.world.dimensions.WIDTH ==
+              defaultValues.world.dimensions.WIDTH);
+        CHECK(testValues.world.fileName == defaultValues.world.fileName);
         CHECK(testValues.evenRuleName == defaultValues.evenRuleName);
 
         CHECK(testValues.oddRuleName == defaultValues.oddRuleName);
       }
     }
   }
-  WORLD_DIMENSIONS = oldDimensions;
-  fileName = oldFile;
 }
 //---------------------------------------------------------------------------
 /**
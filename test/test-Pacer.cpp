@@ -0,0 +1,66 @@
+/**
+ * @file test-Pacer.cpp
+ * @author Group 11
+ * @brief This file contains test cases to test the class Pacer
+ * @details These test cases will strive to ensure that a paced loop follows
+ * its target rate, and that an unpaced loop is not slowed down.
+ */
+
+#include <chrono>
+#include "Support/Pacer.h"
+#include "catch.hpp"
+
+//---------------------------------------------------------------------------
+/// @brief Tag used with CATCH to run test in this test file
+#define PACER_TAG "[Pacer]"
+
+/**
+ * @brief Tests pacing a loop
+ * @details A loop of 20 ticks is paced to 200 ticks per second, it should
+ * take about 100 ms. Without pacing it should not sleep at all.
+ */
+SCENARIO("A loop is paced to a target rate", PACER_TAG) {
+  GIVEN("a pacer of 200 ticks per second") {
+    Pacer pacer(200.0);
+
+    WHEN("20 ticks are waited for") {
+      auto start = std::chrono::steady_clock::now();
+      for (int tick = 0; tick < 20; tick++)
+        pacer.wait();
+      double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+      THEN("the loop should take at least the 20 intervals") {
+        REQUIRE(seconds >= 0.095);
+      }
+      THEN("the achieved rate should be close to the target") {
+        REQUIRE(pacer.getAchievedRate() > 150.0);
+        REQUIRE(pacer.getAchievedRate() < 230.0);
+      }
+    }
+
+    WHEN("10 ticks are waited for at once") {
+      auto start = std::chrono::steady_clock::now();
+      pacer.wait(10);
+      double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+      THEN("it should sleep for 10 intervals") {
+        REQUIRE(seconds >= 0.045);
+      }
+    }
+  }
+
+  GIVEN("a pacer without a target rate") {
+    Pacer pacer(0.0);
+
+    WHEN("1000 ticks are waited for") {
+      auto start = std::chrono::steady_clock::now();
+      for (int tick = 0; tick < 1000; tick++)
+        pacer.wait();
+      double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+      THEN("it should not sleep") {
+        REQUIRE(seconds < 0.05);
+      }
+    }
+  }
+}
@@ -8,6 +8,7 @@
  */
 
 #include <catch.hpp>
+#include <fstream>
 #include <string>
 #include "../include/Cell_Culture/Population.h"
 
@@ -110,7 +111,7 @@ SCENARIO("Get the value of a specific cell in the population", POPULAITON_TAG) {
 /**
  * @brief Tests getTotalCellPopulation
  * @details Test to make sure that the funciton returns the correct value. The
- * standard WORLD_DIMENSIONS should return the value 80+2x24+2 == 1920.
+ * standard world dimensions should return the value 80+2x24+2 == 1920.
  */
 SCENARIO("Check the total cell population", POPULAITON_TAG) {
   GIVEN("a Population object is created by default constructor and initiated") {
@@ -118,7 +119,320 @@ SCENARIO("Check the total cell population", POPULAITON_TAG) {
     pop.initiatePopulation("");
     THEN("The entire population should be WIDTH * HEIGHT") {
       REQUIRE(pop.getTotalCellPopulation() ==
-              ((WORLD_DIMENSIONS.HEIGHT + 2) * (WORLD_DIMENSIONS.WIDTH + 2)));
+              ((pop.getWorldDimensions().HEIGHT + 2) *
+               (pop.getWorldDimensions().WIDTH + 2)));
+    }
+  }
+}
+//---------------------------------------------------------------------------
+/**
+ * @brief Tests initiatePopulation with a rule map
+ * @details A rule map file with a single area is created for the test. The
+ * tiles inside the area should use the mapped rule while the rest of the world
+ * uses the default rules.
+ */
+SCENARIO("A rule map is given to initiatePopulation", POPULAITON_TAG) {
+  GIVEN("a Population object and a rule map file") {
+    std::ofstream of("testPopulationRuleMap.txt");
+    of << "1 1 8x8 erik von_neumann\n";
+    of.close();
+
+    Population pop;
+    pop.setTileSize(8);
+    pop.initiatePopulation("conway", "", "testPopulationRuleMap.txt");
+    WHEN("the tiles are inspected") {
+      const vector<RuleTile>& tiles = pop.getRuleTiles();
+      THEN("tiles inside the area should use the mapped rules") {
+        REQUIRE_FALSE(tiles.empty());
+        for (auto& tile : tiles) {
+          if (tile.region.topLeft.x >= 1 && tile.region.bottomRight.x <= 8 &&
+              tile.region.topLeft.y >= 1 && tile.region.bottomRight.y <= 8) {
+            REQUIRE(tile.evenRule->getRuleName() == "erik");
+            REQUIRE(tile.oddRule->getRuleName() == "von_neumann");
+          } else {
+            REQUIRE(tile.evenRule == pop.getEvenRule());
+            REQUIRE(tile.oddRule == pop.getOddRule());
+          }
+        }
+      }
+      THEN("generations should still be calculated") {
+        pop.calculateNewGeneration();
+        pop.calculateNewGeneration();
+        REQUIRE(pop.getGeneration() == 2);
+      }
+    }
+  }
+}
+//---------------------------------------------------------------------------
+/**
+ * @brief Tests two generations per sweep
+ * @details Rules with step tables are composed and advances two generations
+ * per call to calculateNewGeneration, erik has no step table and advances one.
+ */
+SCENARIO("Two generations per sweep is asked for", POPULAITON_TAG) {
+  GIVEN("a Population object using conway and von_neumann") {
+    Population pop;
+    pop.initiatePopulation("conway", "von_neumann");
+    pop.setGenerationsPerSweep(2);
+    WHEN("a new generation is calculated") {
+      THEN("two generations should be advanced") {
+        REQUIRE(pop.getGenerationsPerSweep() == 2);
+        REQUIRE(pop.calculateNewGeneration() == 2);
+        REQUIRE(pop.calculateNewGeneration() == 4);
+      }
+    }
+  }
+  GIVEN("a Population object using erik") {
+    Population pop;
+    pop.initiatePopulation("erik");
+    pop.setGenerationsPerSweep(2);
+    WHEN("a new generation is calculated") {
+      THEN("one generation should be advanced") {
+        REQUIRE(pop.getGenerationsPerSweep() == 1);
+        REQUIRE(pop.calculateNewGeneration() == 1);
+      }
+    }
+  }
+}
+//---------------------------------------------------------------------------
+/**
+ * @brief Tests calculating generations with several threads
+ * @details Four populations are read from the same file, one calculated
+ * with a single thread, one with three threads in bands, one with three
+ * threads and work stealing, and one with two threads pinned to the NUMA
+ * nodes, all with small tiles. Every cell, including
+ * the color of the erik prime elder, should be the same after each
+ * generation.
+ */
+SCENARIO("Generations are calculated by several threads", POPULAITON_TAG) {
+  GIVEN("four Population objects using erik, read from the same file") {
+    std::ofstream of("testPopulationThreads.txt");
+    of << "30x20\n";
+    for (int row = 1; row <= 20; row++) {
+      for (int column = 1; column <= 30; column++)
+        of << (((column * 7 + row * 11) % 5 < 2) ? '1' : '0');
+      of << "\n";
+    }
+    of.close();
+    WorldSettings world;
+    world.fileName = "testPopulationThreads.txt";
+
+    Population serial;
+    serial.setWorld(world);
+    serial.initiatePopulation("erik", "conway");
+    Population threaded;
+    threaded.setWorld(world);
+    threaded.setTileSize(4);
+    threaded.setThreadCount(3);
+    threaded.initiatePopulation("erik", "conway");
+    Population stealing;
+    stealing.setWorld(world);
+    stealing.setTileSize(4);
+    stealing.setThreadCount(3);
+    stealing.setWorkStealing(true);
+    stealing.initiatePopulation("erik", "conway");
+    Population pinned;
+    pinned.setWorld(world);
+    pinned.setTileSize(4);
+    pinned.initiatePopulation("erik", "conway");
+    pinned.setThreadCount(2);
+    pinned.setThreadPinning(true);
+
+    WHEN("30 generations are calculated") {
+      bool same = true;
+      for (int generation = 0; generation < 30; generation++) {
+        serial.calculateNewGeneration();
+        threaded.calculateNewGeneration();
+        stealing.calculateNewGeneration();
+        pinned.calculateNewGeneration();
+        for (int row = 0; row <= 21; row++) {
+          for (int column = 0; column <= 31; column++) {
+            Cell &expected = serial.getCellAtPosition(Point{column, row});
+            for (Population *population : {&threaded, &stealing, &pinned}) {
+              Cell &actual = population->getCellAtPosition(Point{column, row});
+              same = same && expected.getAge() == actual.getAge() &&
+                     expected.getColor() == actual.getColor() &&
+                     expected.getCellValue() == actual.getCellValue();
+            }
+          }
+        }
+      }
+      THEN("the cells should be the same") {
+        REQUIRE(threaded.getThreadCount() == 3);
+        REQUIRE(same);
+      }
+      THEN("the work stealing stats should cover every thread") {
+        REQUIRE(stealing.getWorkerStats().size() == 3);
+        REQUIRE(threaded.getWorkerStats().empty());
+      }
+      THEN("the node stats should cover every pinned thread") {
+        int threads = 0;
+        for (auto &node : pinned.getNodeStats()) {
+          threads += node.threads;
+          REQUIRE(node.bytes > 0);
+        }
+        REQUIRE(threads == 2);
+        REQUIRE(threaded.getNodeStats().empty());
+      }
+    }
+  }
+}
+//---------------------------------------------------------------------------
+/**
+ * @brief Tests takeSnapshot
+ * @details The frame should hold the same as the cells of the population.
+ */
+SCENARIO("A snapshot of the population is taken", POPULAITON_TAG) {
+  GIVEN("a Population object with a random world") {
+    Population pop;
+    pop.initiatePopulation("conway");
+    pop.calculateNewGeneration();
+    WHEN("a snapshot is taken") {
+      Frame frame;
+      pop.takeSnapshot(frame);
+      THEN("the frame should hold every cell") {
+        REQUIRE(frame.generation == 1);
+        REQUIRE(frame.width == pop.getWorldDimensions().WIDTH + 2);
+        REQUIRE(frame.height == pop.getWorldDimensions().HEIGHT + 2);
+        bool same = true;
+        for (int row = 0; row < frame.height; row++) {
+          for (int column = 0; column < frame.width; column++) {
+            Cell &cell = pop.getCellAtPosition(Point{column, row});
+            size_t index = frame.index(column, row);
+            same = same && frame.values[index] == cell.getCellValue() &&
+                   frame.colors[index] == cell.getColor() &&
+                   (frame.alive[index] != 0) == cell.isAlive() &&
+                   frame.isRim(column, row) == cell.isRimCell();
+          }
+        }
+        REQUIRE(same);
+      }
+    }
+  }
+}
+//---------------------------------------------------------------------------
+/**
+ * @brief Tests pinGeneration
+ * @details A pinned generation should not change while later generations
+ * are calculated.
+ */
+SCENARIO("A generation of the population is pinned", POPULAITON_TAG) {
+  GIVEN("a Population object publishing snapshots") {
+    Population pop;
+    pop.initiatePopulation("conway");
+    THEN("nothing is pinned before snapshots are enabled") {
+      REQUIRE_FALSE(pop.pinGeneration());
+    }
+    pop.enableSnapshots(3);
+    WHEN("a generation is pinned and more generations are calculated") {
+      PinnedFrame pinned = pop.pinGeneration();
+      Frame copy = *pinned.get();
+      for (int generation = 0; generation < 5; generation++)
+        pop.calculateNewGeneration();
+      THEN("the pinned generation should be unchanged") {
+        REQUIRE(pinned->generation == 0);
+        REQUIRE(pinned->alive == copy.alive);
+        REQUIRE(pinned->colors == copy.colors);
+      }
+      THEN("the newest generation should be pinned next") {
+        REQUIRE(pop.pinGeneration()->generation == 5);
+      }
+    }
+  }
+}
+//---------------------------------------------------------------------------
+/**
+ * @brief Tests setWorld with a random world
+ * @details The random world should only depend on the seed, and follow the
+ * density. Uses a world of 100x150 cells, three chunks of rows.
+ */
+SCENARIO("A random world is filled from a seed", POPULAITON_TAG) {
+  GIVEN("a large world and a seed") {
+    WorldSettings world;
+    world.dimensions = Dimensions{100, 150};
+    world.randomFill = RandomFill(42, 0.5);
+    WorldSettings otherWorld = world;
+    otherWorld.randomFill.seed = 43;
+
+    WHEN("two populations are filled from the same seed with different threads") {
+      Population first;
+      first.setWorld(world);
+      first.initiatePopulation("conway");
+      Population second;
+      second.setThreadCount(3);
+      second.setWorld(world);
+      second.initiatePopulation("conway");
+      Population other;
+      other.setWorld(otherWorld);
+      other.initiatePopulation("conway");
+
+      THEN("the worlds of the same seed should be the same") {
+        bool same = true;
+        bool differs = false;
+        for (int row = 0; row <= 151; row++) {
+          for (int column = 0; column <= 101; column++) {
+            Point point{column, row};
+            bool alive = first.getCellAtPosition(point).isAlive();
+            same = same && alive == second.getCellAtPosition(point).isAlive();
+            differs = differs || alive != other.getCellAtPosition(point).isAlive();
+          }
+        }
+        REQUIRE(same);
+        REQUIRE(differs);
+      }
+    }
+
+    WHEN("a population is filled with a density of 0.2") {
+      Population pop;
+      world.randomFill = RandomFill(7, 0.2);
+      pop.setWorld(world);
+      pop.initiatePopulation("conway");
+
+      THEN("about a fifth of the cells should be alive, and no rim cell") {
+        int alive = 0;
+        bool rimAlive = false;
+        for (int row = 0; row <= 151; row++) {
+          for (int column = 0; column <= 101; column++) {
+            Cell &cell = pop.getCellAtPosition(Point{column, row});
+            if (cell.isRimCell())
+              rimAlive = rimAlive || cell.isAlive();
+            else if (cell.isAlive())
+              alive++;
+          }
+        }
+        REQUIRE(alive > 2700);
+        REQUIRE(alive < 3300);
+        REQUIRE_FALSE(rimAlive);
+        REQUIRE(pop.getTotalCellPopulation() == 102 * 152);
+      }
+    }
+
+    WHEN("a population only holds rows 60 to 70, across two chunks") {
+      Population whole;
+      whole.setWorld(world);
+      whole.initiatePopulation("conway");
+      Population slab;
+      slab.setWorld(world);
+      slab.setRows(60, 70);
+      slab.initiatePopulation("conway");
+
+      THEN("only the rows and the halo should be created, as in the whole world") {
+        REQUIRE(slab.getTotalCellPopulation() == 102 * 13);
+        bool same = true;
+        for (int row = 59; row <= 71; row++) {
+          for (int column = 0; column <= 101; column++) {
+            Point point{column, row};
+            same = same && whole.getCellAtPosition(point).isAlive()
+                == slab.getCellAtPosition(point).isAlive();
+          }
+        }
+        REQUIRE(same);
+      }
+      THEN("only the rows should be split into tiles") {
+        const vector<RuleTile> &tiles = slab.getRuleTiles();
+        REQUIRE(tiles.front().region.topLeft.y == 60);
+        REQUIRE(tiles.back().region.bottomRight.y == 70);
+      }
     }
   }
 }
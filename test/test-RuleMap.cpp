@@ -0,0 +1,138 @@
+/**
+ * @file test-RuleMap.cpp
+ * @author Group 11
+ * @brief This file contains test cases to test the class RuleMap
+ * @details These test cases will strive to ensure that rule areas are read
+ * from file correctly and that the world is split into tiles with a single
+ * rule assignment each.
+ */
+
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include "GoL_Rules/RuleMap.h"
+#include "catch.hpp"
+
+//---------------------------------------------------------------------------
+/// @brief Tag used with CATCH to run test in this test file
+#define RULEMAP_TAG "[RuleMap]"
+
+/**
+ * @brief Test loading rule areas from file
+ * @details A file with two areas, a comment and an empty line is created for
+ * the test. Missing and malformed files should throw.
+ */
+SCENARIO("Loading a rule map from file", RULEMAP_TAG) {
+  GIVEN("A rule map file with two areas") {
+    std::ofstream of("testRuleMap.txt");
+    of << "# left half uses erik\n"
+          "1 1 10x5 erik\n"
+          "\n"
+          "11 1 10x5 von_neumann conway\n";
+    of.close();
+
+    RuleMap ruleMap;
+    WHEN("The file is loaded") {
+      ruleMap.loadFromFile("testRuleMap.txt");
+      THEN("Both areas should be read") {
+        REQUIRE(ruleMap.getAreas().size() == 2);
+      }
+      THEN("The first area should use erik for both even and odd") {
+        const RuleArea& area = ruleMap.getAreas()[0];
+        REQUIRE(area.region.topLeft.x == 1);
+        REQUIRE(area.region.topLeft.y == 1);
+        REQUIRE(area.region.bottomRight.x == 10);
+        REQUIRE(area.region.bottomRight.y == 5);
+        REQUIRE(area.evenRuleName == "erik");
+        REQUIRE(area.oddRuleName == "erik");
+      }
+      THEN("The second area should have separate even and odd rules") {
+        const RuleArea& area = ruleMap.getAreas()[1];
+        REQUIRE(area.region.topLeft.x == 11);
+        REQUIRE(area.evenRuleName == "von_neumann");
+        REQUIRE(area.oddRuleName == "conway");
+      }
+    }
+  }
+  GIVEN("Rule map files that can't be used") {
+    std::ofstream of("testRuleMapInvalid.txt");
+    of << "1 1 ten erik\n";
+    of.close();
+
+    RuleMap ruleMap;
+    // mute the error messages printed by the class
+    std::stringstream buffer;
+    std::streambuf* old = std::cout.rdbuf(buffer.rdbuf());
+    THEN("A missing file should throw an exception") {
+      REQUIRE_THROWS_AS(ruleMap.loadFromFile("missingRuleMap.txt"),
+                        std::ios_base::failure);
+    }
+    THEN("A malformed line should throw an exception") {
+      REQUIRE_THROWS_AS(ruleMap.loadFromFile("testRuleMapInvalid.txt"),
+                        std::ios_base::failure);
+    }
+    std::cout.rdbuf(old);
+  }
+}
+//---------------------------------------------------------------------------
+/**
+ * @brief Test splitting the world into tiles
+ * @details Uses a world of 20x10 cells, 22x12 with rim cells, and an area that
+ * does not line up with the tile size.
+ */
+SCENARIO("Partition the world into rule tiles", RULEMAP_TAG) {
+  GIVEN("A world of 22x12 cells and a rule map with one area") {
+    Region world{Point{0, 0}, Point{21, 11}};
+    RuleMap ruleMap;
+    ruleMap.addArea(Region{Point{3, 2}, Point{12, 6}}, "erik");
+
+    WHEN("The world is partitioned with tile size 8") {
+      vector<RuleArea> tiles = ruleMap.partition(world, 8);
+
+      THEN("Every cell should be covered by exactly one tile") {
+        for (int row = 0; row <= 11; row++) {
+          for (int column = 0; column <= 21; column++) {
+            int covered = 0;
+            for (auto& tile : tiles) {
+              if (tile.region.contains(Point{column, row})) covered++;
+            }
+            REQUIRE(covered == 1);
+          }
+        }
+      }
+      THEN("No tile should be larger than the tile size") {
+        for (auto& tile : tiles) {
+          REQUIRE(tile.region.bottomRight.x - tile.region.topLeft.x < 8);
+          REQUIRE(tile.region.bottomRight.y - tile.region.topLeft.y < 8);
+        }
+      }
+      THEN("Only tiles inside the area should use the area rule") {
+        for (auto& tile : tiles) {
+          bool inside = tile.region.topLeft.x >= 3 &&
+                        tile.region.bottomRight.x <= 12 &&
+                        tile.region.topLeft.y >= 2 &&
+                        tile.region.bottomRight.y <= 6;
+          REQUIRE((tile.evenRuleName == "erik") == inside);
+          REQUIRE(tile.evenRuleName == tile.oddRuleName);
+        }
+      }
+    }
+    WHEN("A second overlapping area is added") {
+      ruleMap.addArea(Region{Point{10, 5}, Point{15, 8}}, "von_neumann");
+      vector<RuleArea> tiles = ruleMap.partition(world, 0);
+
+      THEN("The last added area should be used where they overlap") {
+        for (auto& tile : tiles) {
+          if (tile.region.contains(Point{11, 5})) {
+            REQUIRE(tile.evenRuleName == "von_neumann");
+          }
+          if (tile.region.contains(Point{9, 5})) {
+            REQUIRE(tile.evenRuleName == "erik");
+          }
+        }
+      }
+    }
+  }
+}
+//---------------------------------------------------------------------------
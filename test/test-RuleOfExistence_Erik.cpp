@@ -722,4 +722,82 @@ SCENARIO("RuleOfExistence_Erik: Test that only 1 oldest cell can be an elder",
             }
         }
     }
-}
\ No newline at end of file
+}
+
+/**
+ * @brief Test that elder candidates are merged deterministically
+ * @details The oldest candidate should win, for equal ages the position first
+ * in map order should win, regardless of the order of the merges.
+ */
+SCENARIO("RuleOfExistence_Erik: Elder candidates are merged in any order",
+         ERIK_TEST_TAG) {
+    GIVEN("Three candidates, two of them with the same age") {
+        ElderCandidate none{Point{0, 0}, 0, false};
+        ElderCandidate first{Point{1, 2}, 12, true};
+        ElderCandidate second{Point{2, 1}, 12, true};
+        ElderCandidate younger{Point{1, 1}, 11, true};
+
+        WHEN("The candidates are merged in two different orders") {
+            ElderCandidate forward = none;
+            forward.merge(younger);
+            forward.merge(first);
+            forward.merge(second);
+            forward.merge(none);
+
+            ElderCandidate backward = none;
+            backward.merge(second);
+            backward.merge(first);
+            backward.merge(younger);
+
+            THEN("The oldest, first in map order, should win both times") {
+                REQUIRE(forward.found);
+                REQUIRE(TestPoint(forward.position) == TestPoint(1, 2));
+                REQUIRE(TestPoint(backward.position) == TestPoint(1, 2));
+                REQUIRE(backward.age == 12);
+            }
+        }
+    }
+}
+
+/**
+ * @brief Test that the elder does not depend on how the board is split
+ * @details Using a game board of [3,3] raw [5,5] where three cells of the
+ * same age keeps each other alive. The regions are executed right to left.
+ */
+SCENARIO("RuleOfExistence_Erik: The elder is the same when executed per region",
+         ERIK_TEST_TAG) {
+    GIVEN("Three cells of the same age and a rule executed in two regions") {
+        map<Point, Cell> cells;
+        TestUtil::createMap(cells, 3, 3, true);
+
+        TestPoint testPoint0(1, 1);
+        TestPoint testPoint1(1, 2);
+        TestPoint testPoint2(2, 2);
+        TestUtilCell::setCellAge(cells.at(testPoint0.toPoint()), 12);
+        TestUtilCell::setCellAge(cells.at(testPoint1.toPoint()), 12);
+        TestUtilCell::setCellAge(cells.at(testPoint2.toPoint()), 12);
+
+        RuleOfExistence_Erik testInstance(cells);
+
+        WHEN("The right region is executed before the left region") {
+            testInstance.beginGeneration();
+            testInstance.executeRule(Region{Point{2, 0}, Point{4, 4}});
+            testInstance.executeRule(Region{Point{0, 0}, Point{1, 4}});
+            testInstance.endGeneration();
+            for (auto &cell : cells)
+                cell.second.updateState();
+
+            THEN("The cell first in map order should be the only elder") {
+                Point elder{0, 0};
+                REQUIRE(testInstance.getPrimeElder(elder));
+                REQUIRE(TestPoint(elder) == testPoint0);
+                REQUIRE(cells.at(testPoint0.toPoint()).getColor() ==
+                        STATE_COLORS.ELDER);
+                REQUIRE(cells.at(testPoint1.toPoint()).getColor() ==
+                        STATE_COLORS.OLD);
+                REQUIRE(cells.at(testPoint2.toPoint()).getColor() ==
+                        STATE_COLORS.OLD);
+            }
+        }
+    }
+}
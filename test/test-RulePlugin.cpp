@@ -0,0 +1,85 @@
+/**
+ * @file test-RulePlugin.cpp
+ * @author Group 11
+ *
+ * @brief This file contains test for loading rule plugins and the class
+ * RuleOfExistence_Plugin
+ *
+ * @details Loads the sample plugin HighLife that is built together with the
+ * tests. HighLife differs from Conway by giving life to dead cells with 6
+ * alive neighbours.
+ */
+
+#include "catch.hpp"
+#include "GoL_Rules/RuleFactory.h"
+#include "TestUtil.h"
+
+/// @brief Tag used with CATCH to run test in this test file
+#define RULE_PLUGIN_TAG "[RulePlugin]"
+
+#ifdef GOL_PLUGIN_DIR
+
+/**
+ * @brief Test that the sample plugin is loaded and registered by name
+ */
+SCENARIO("Rule plugins are loaded from a directory", RULE_PLUGIN_TAG) {
+    GIVEN("The directory with the sample plugins") {
+        RuleFactory &ruleFactory = RuleFactory::getInstance();
+
+        WHEN("The plugins are loaded") {
+            int loaded = ruleFactory.loadPlugins(GOL_PLUGIN_DIR);
+
+            THEN("The sample plugin should be registered") {
+                REQUIRE(loaded >= 1);
+                REQUIRE(ruleFactory.isRegistered("highlife"));
+            }
+        }
+
+        WHEN("A directory that does not exist is loaded") {
+            THEN("No plugins should be loaded") {
+                REQUIRE(ruleFactory.loadPlugins("no_such_directory") == 0);
+            }
+        }
+    }
+}
+
+/**
+ * @brief Test that a rule created from the plugin follows the plugin result
+ * @details Using a game board of [3,3], [5,5] with rim cells, where the
+ * center cell is dead and has 6 alive neighbours
+ */
+SCENARIO("A rule created from a plugin uses the plugin step function",
+         RULE_PLUGIN_TAG) {
+    GIVEN("A dead cell with 6 alive neighbours and the HighLife rule") {
+        map<Point, Cell> cells;
+        TestUtil::createMap(cells, 3, 3, true);
+        TestPoint testPoint(2, 2);
+        TestUtil::setCellAliveNeighbours(cells, testPoint, ALL_DIRECTIONS, 6);
+
+        RuleFactory &ruleFactory = RuleFactory::getInstance();
+        ruleFactory.loadPlugins(GOL_PLUGIN_DIR);
+        RuleOfExistence *rule = ruleFactory.createAndReturnRule(cells,
+                                                                "highlife");
+
+        THEN("The rule should have the name of the plugin") {
+            REQUIRE(rule->getRuleName() == "highlife");
+        }
+
+        WHEN("The rule is executed") {
+            rule->executeRule();
+            Cell &testCell = cells.at(testPoint.toPoint());
+
+            THEN("The dead cell should be given life") {
+                REQUIRE(testCell.getNextGenerationAction() == GIVE_CELL_LIFE);
+            }
+            THEN("A cell with more than 3 alive neighbours should be killed") {
+                // The cell to the east has 4 alive neighbours
+                REQUIRE(cells.at(Point{3, 2}).getNextGenerationAction() ==
+                        KILL_CELL);
+            }
+        }
+        delete rule;
+    }
+}
+
+#endif
@@ -4,6 +4,7 @@
  * @brief This file contains test cases for the class ScreenPrinter.
  *
  */
+#include <algorithm>
 #include <iostream>
 #include <sstream>
 #include <string>
@@ -80,18 +81,14 @@ SCENARIO("Calling the printHelpScreen function", SCREENPRINTER_TAG) {
  */
 SCENARIO("Printing the World with the PrintBoard function", SCREENPRINTER_TAG) {
   GIVEN("A gameworld created by a Population object to print") {
-    // Save previously stored values
-    Dimensions oldDimensions;
-
-    oldDimensions.HEIGHT = WORLD_DIMENSIONS.HEIGHT;
-    oldDimensions.WIDTH = WORLD_DIMENSIONS.WIDTH;
-
     // Create values for a smaller world as large values cause problems in
     // testing
-    WORLD_DIMENSIONS.HEIGHT = 5;
-    WORLD_DIMENSIONS.WIDTH = 6;
+    WorldSettings world;
+    world.dimensions.HEIGHT = 5;
+    world.dimensions.WIDTH = 6;
 
     Population testPop;
+    testPop.setWorld(world);
     testPop.initiatePopulation("", "");
 
     WHEN(
@@ -115,11 +112,123 @@ SCENARIO("Printing the World with the PrintBoard function", SCREENPRINTER_TAG) {
           "The printed World size should be equal to the population size "
           "minus rimcells as no newlines are printed") {
         CHECK(redirectString.size() ==
-              (WORLD_DIMENSIONS.HEIGHT * WORLD_DIMENSIONS.WIDTH));
+              (world.dimensions.HEIGHT * world.dimensions.WIDTH));
+      }
+    }
+  }
+}
+
+/**
+ * @brief Test that only the changed cells of a frame are printed
+ * @details A frame of 6x5 cells is printed after the screen is cleared, and
+ * then printed again with and without a changed cell. The output is
+ * redirected to a std::string.
+ */
+SCENARIO("Printing the changes between frames with the PrintBoard function",
+         SCREENPRINTER_TAG) {
+  GIVEN("A frame of 6x5 cells, printed on a cleared screen") {
+    Frame frame;
+    frame.generation = 0;
+    frame.width = 8;
+    frame.height = 7;
+    frame.values.assign(8 * 7, '.');
+    frame.colors.assign(8 * 7, STATE_COLORS.LIVING);
+    frame.alive.assign(8 * 7, 0);
+
+    std::stringstream bufferStream;
+    std::streambuf* oldBuf = std::cout.rdbuf(bufferStream.rdbuf());
+    ScreenPrinter::getInstance().clearScreen();
+    bufferStream.str("");
+    ScreenPrinter::getInstance().printBoard(frame);
+    std::string fullPrint = bufferStream.str();
+    std::cout.rdbuf(oldBuf);
+
+    THEN("Every cell should be printed") {
+      REQUIRE(std::count(fullPrint.begin(), fullPrint.end(), '.') == 30);
+    }
+
+    THEN("The color should only be set once, and reset once") {
+      REQUIRE(fullPrint.find("\x1B[1;37;40m") != std::string::npos);
+      REQUIRE(fullPrint.find("\x1B[1;37;40m") == fullPrint.rfind("\x1B[1;37;40m"));
+      REQUIRE(fullPrint.find("\x1B[0m") == fullPrint.rfind("\x1B[0m"));
+    }
+
+    THEN("The cursor should only be moved at the start of each row, and below the board") {
+      REQUIRE(std::count(fullPrint.begin(), fullPrint.end(), 'H') == 5 + 1);
+    }
+
+    WHEN("The same frame is printed again") {
+      oldBuf = std::cout.rdbuf(bufferStream.rdbuf());
+      bufferStream.str("");
+      ScreenPrinter::getInstance().printBoard(frame);
+      std::string print = bufferStream.str();
+      std::cout.rdbuf(oldBuf);
+
+      THEN("No cell should be printed") {
+        REQUIRE(std::count(print.begin(), print.end(), '.') == 0);
+      }
+    }
+
+    WHEN("The frame is printed with one changed cell") {
+      frame.values[frame.index(3, 2)] = '#';
+      oldBuf = std::cout.rdbuf(bufferStream.rdbuf());
+      bufferStream.str("");
+      ScreenPrinter::getInstance().printBoard(frame);
+      std::string print = bufferStream.str();
+      std::cout.rdbuf(oldBuf);
+
+      THEN("Only the changed cell should be printed") {
+        REQUIRE(std::count(print.begin(), print.end(), '#') == 1);
+        REQUIRE(std::count(print.begin(), print.end(), '.') == 0);
+        REQUIRE(print.size() < fullPrint.size());
       }
     }
-    // restore the old values to isolate the test case changes.
-    WORLD_DIMENSIONS.HEIGHT = oldDimensions.HEIGHT;
-    WORLD_DIMENSIONS.WIDTH = oldDimensions.WIDTH;
   }
-}
\ No newline at end of file
+}
+
+/**
+ * @brief Test printing a frame with synchronized output
+ * @details The frame is printed on the alternate screen, wrapped in the
+ * synchronized update escapes, and the screen from before is restored when it
+ * is turned off.
+ */
+SCENARIO("Printing a frame with synchronized output", SCREENPRINTER_TAG) {
+  GIVEN("A frame of 6x5 cells") {
+    Frame frame;
+    frame.generation = 0;
+    frame.width = 8;
+    frame.height = 7;
+    frame.values.assign(frame.width * frame.height, '.');
+    frame.colors.assign(frame.width * frame.height, STATE_COLORS.LIVING);
+    frame.alive.assign(frame.width * frame.height, 0);
+
+    WHEN("It is printed with synchronized output turned on, and then off") {
+      std::stringstream bufferStream;
+      std::streambuf* oldBuf = std::cout.rdbuf(bufferStream.rdbuf());
+      ScreenPrinter::getInstance().setSynchronizedOutput(true);
+      std::string enter = bufferStream.str();
+      bufferStream.str("");
+      ScreenPrinter::getInstance().printBoard(frame);
+      std::string print = bufferStream.str();
+      bufferStream.str("");
+      ScreenPrinter::getInstance().setSynchronizedOutput(false);
+      std::string leave = bufferStream.str();
+      std::cout.rdbuf(oldBuf);
+
+      THEN("The alternate screen should be entered and left") {
+        REQUIRE(enter == "\x1B[?1049h");
+        REQUIRE(leave.find("\x1B[?1049l") == 0);
+      }
+
+      THEN("The frame should be wrapped in the synchronized update escapes") {
+        REQUIRE(print.find("\x1B[?2026h") == 0);
+        REQUIRE(print.rfind("\x1B[?2026l") == print.size() - 8);
+        REQUIRE(std::count(print.begin(), print.end(), '.') == 30);
+      }
+
+      THEN("A write to a string should not make the terminal fall behind") {
+        REQUIRE_FALSE(ScreenPrinter::getInstance().isTerminalBehind());
+      }
+    }
+  }
+}
@@ -0,0 +1,111 @@
+/**
+ * @file test-SlabSimulation.cpp
+ * @author Group 11
+ * @brief This file contains test cases to test the class SlabSimulation
+ * @details These test cases will strive to ensure that a world calculated
+ * in slabs by several processes is the same as when calculated by one.
+ */
+
+#include <fstream>
+#include <ios>
+#include "SlabSimulation.h"
+#include "catch.hpp"
+
+//---------------------------------------------------------------------------
+/// @brief Tag used with CATCH to run test in this test file
+#define SLABSIMULATION_TAG "[SlabSimulation]"
+
+/**
+ * @brief Tests calculating slabs in worker processes
+ * @details One population is read from a file and calculated by
+ * calculateNewGeneration, the same file is calculated by three worker
+ * processes that each build only their own rows. The frame gathered from the
+ * workers should show the same cells.
+ */
+SCENARIO("Generations are calculated in slabs by worker processes", SLABSIMULATION_TAG) {
+  GIVEN("a Population using conway and von_neumann, and a file of its world") {
+    std::ofstream of("testSlabSimulation.txt");
+    of << "24x18\n";
+    for (int row = 1; row <= 18; row++) {
+      for (int column = 1; column <= 24; column++)
+        of << (((column * 5 + row * 3) % 7 < 3) ? '1' : '0');
+      of << "\n";
+    }
+    of.close();
+    WorldSettings world;
+    world.fileName = "testSlabSimulation.txt";
+
+    Population serial;
+    serial.setWorld(world);
+    serial.setTileSize(4);
+    serial.initiatePopulation("conway", "von_neumann");
+
+    WHEN("25 generations are calculated") {
+      for (int generation = 0; generation < 25; generation++)
+        serial.calculateNewGeneration();
+      Frame expected;
+      serial.takeSnapshot(expected);
+      SlabSimulation slabs(world, "conway", "von_neumann", "", 4, 3);
+      Frame frame;
+      slabs.run(25, &frame);
+
+      THEN("the cells should be the same") {
+        REQUIRE(frame.generation == serial.getGeneration());
+        REQUIRE(frame.width == expected.width);
+        REQUIRE(frame.height == expected.height);
+        REQUIRE(frame.values == expected.values);
+        REQUIRE(frame.colors == expected.colors);
+        REQUIRE(frame.alive == expected.alive);
+      }
+      THEN("the stats should cover every row once") {
+        REQUIRE(slabs.getStats().size() == 3);
+        int nextRow = 0;
+        unsigned long alive = 0;
+        for (auto &stats : slabs.getStats()) {
+          REQUIRE(stats.firstRow == nextRow);
+          nextRow = stats.lastRow + 1;
+          alive += stats.aliveCells;
+        }
+        REQUIRE(nextRow == 20);
+        unsigned long expectedAlive = 0;
+        for (unsigned char cell : expected.alive)
+          expectedAlive += cell;
+        REQUIRE(alive == expectedAlive);
+      }
+    }
+  }
+  GIVEN("a random world of 40x150, more rows than one random chunk") {
+    WorldSettings world;
+    world.dimensions = {40, 150};
+    world.randomFill.seed = 11;
+
+    Population serial;
+    serial.setWorld(world);
+    serial.initiatePopulation("conway");
+
+    WHEN("10 generations are calculated, only the stats collected") {
+      for (int generation = 0; generation < 10; generation++)
+        serial.calculateNewGeneration();
+      Frame expected;
+      serial.takeSnapshot(expected);
+      SlabSimulation slabs(world, "conway", "", "", DEFAULT_TILE_SIZE, 4);
+      slabs.run(10);
+
+      THEN("the slabs should have the alive cells of the whole world") {
+        unsigned long alive = 0;
+        for (auto &stats : slabs.getStats())
+          alive += stats.aliveCells;
+        unsigned long expectedAlive = 0;
+        for (unsigned char cell : expected.alive)
+          expectedAlive += cell;
+        REQUIRE(alive == expectedAlive);
+      }
+    }
+  }
+  GIVEN("a world using erik") {
+    THEN("the rules should not be split into slabs") {
+      SlabSimulation slabs(WorldSettings(), "erik", "", "", DEFAULT_TILE_SIZE, 2);
+      REQUIRE_THROWS_AS(slabs.run(1), std::ios_base::failure);
+    }
+  }
+}
@@ -0,0 +1,65 @@
+/**
+ * @file test-ThreadPool.cpp
+ * @author Group 11
+ * @brief This file contains test cases to test the class ThreadPool
+ * @details These test cases will strive to ensure that a task is run once
+ * for every worker, and that failures are reported to the caller.
+ */
+
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+#include "Support/ThreadPool.h"
+#include "catch.hpp"
+
+//---------------------------------------------------------------------------
+/// @brief Tag used with CATCH to run test in this test file
+#define THREADPOOL_TAG "[ThreadPool]"
+
+/**
+ * @brief Test that a task is run by every worker
+ * @details The same pool is used for several rounds, as it is by Population.
+ */
+SCENARIO("A task is run on a thread pool", THREADPOOL_TAG) {
+  GIVEN("A pool with 4 workers") {
+    ThreadPool pool(4);
+    REQUIRE(pool.getThreadCount() == 4);
+
+    WHEN("A task is run three times") {
+      std::vector<std::atomic<int>> calls(4);
+      for (auto &count : calls)
+        count = 0;
+      for (int round = 0; round < 3; round++)
+        pool.run([&calls](int worker) { calls[worker]++; });
+
+      THEN("Every worker should have run the task each time") {
+        for (auto &count : calls)
+          REQUIRE(count == 3);
+      }
+    }
+
+    WHEN("The workers are pinned to the first CPU") {
+      pool.pinWorkers(std::vector<int>(4, 0));
+      std::atomic<int> calls(0);
+      pool.run([&calls](int) { calls++; });
+
+      THEN("Every worker should still run the task") {
+        REQUIRE(calls == 4);
+      }
+    }
+
+    WHEN("A worker throws an exception") {
+      THEN("The exception should be thrown by run") {
+        REQUIRE_THROWS_AS(pool.run([](int worker) {
+          if (worker == 2)
+            throw std::out_of_range("worker 2");
+        }), std::out_of_range);
+      }
+      THEN("The pool should still be usable") {
+        std::atomic<int> calls(0);
+        pool.run([&calls](int) { calls++; });
+        REQUIRE(calls == 4);
+      }
+    }
+  }
+}
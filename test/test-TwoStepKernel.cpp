@@ -0,0 +1,89 @@
+/**
+ * @file test-TwoStepKernel.cpp
+ * @author Group 11
+ * @brief This file contains test cases to test the class TwoStepKernel
+ * @details The kernel is compared with executing the rules on the map of
+ * cells, one generation at a time.
+ */
+
+#include <map>
+#include <vector>
+#include "catch.hpp"
+#include "TestUtil.h"
+#include "TestUtilCell.h"
+#include "GoL_Rules/RuleOfExistence_Conway.h"
+#include "GoL_Rules/RuleOfExistence_VonNeumann.h"
+#include "GoL_Rules/TwoStepKernel.h"
+
+//---------------------------------------------------------------------------
+/// @brief Tag used with CATCH to run test in this test file
+#define TWO_STEP_KERNEL_TAG "[TwoStepKernel]"
+
+/// @brief Packs the alive state of the cells into a dense grid
+static vector<unsigned char> packCells(map<Point, Cell> &cells, int width) {
+  vector<unsigned char> grid(cells.size(), 0);
+  for (auto &cell : cells)
+    grid[cell.first.y * width + cell.first.x] = cell.second.isAlive() ? 1 : 0;
+  return grid;
+}
+
+/// @brief Executes a rule on the map and updates the cells
+static void executeGeneration(map<Point, Cell> &cells, RuleOfExistence &rule) {
+  rule.executeRule();
+  for (auto &cell : cells)
+    cell.second.updateState();
+}
+
+/**
+ * @brief Test that the kernel gives the same result as the rules
+ * @details Using a game board of [10,10] with a fixed pattern of alive cells,
+ * some of them next to the rim.
+ */
+SCENARIO("The two step kernel gives the same generations as the rules",
+         TWO_STEP_KERNEL_TAG) {
+  GIVEN("A game board with a pattern of alive cells") {
+    map<Point, Cell> cells;
+    TestUtil::createMap(cells, 10, 10, true);
+    int width = 12, height = 12;
+    for (auto &cell : cells) {
+      if (!cell.second.isRimCell() &&
+          (cell.first.x * 7 + cell.first.y * 13) % 3 == 0)
+        TestUtilCell::setCellAlive(cell.second);
+    }
+
+    RuleOfExistence_Conway conway(cells);
+    RuleOfExistence_VonNeumann vonNeumann(cells);
+    vector<unsigned char> conwayTable, vonNeumannTable;
+    REQUIRE(conway.getStepTable(conwayTable));
+    REQUIRE(vonNeumann.getStepTable(vonNeumannTable));
+
+    WHEN("Conway followed by von Neumann is calculated both ways") {
+      TwoStepKernel kernel(conwayTable, vonNeumannTable);
+      vector<unsigned char> middle, next;
+      kernel.advance(packCells(cells, width), middle, next, width, height);
+
+      executeGeneration(cells, conway);
+      vector<unsigned char> expectedMiddle = packCells(cells, width);
+      executeGeneration(cells, vonNeumann);
+      vector<unsigned char> expectedNext = packCells(cells, width);
+
+      THEN("Both generations should be the same") {
+        REQUIRE(middle == expectedMiddle);
+        REQUIRE(next == expectedNext);
+      }
+    }
+
+    WHEN("Conway twice is calculated both ways") {
+      TwoStepKernel kernel(conwayTable, conwayTable);
+      vector<unsigned char> middle, next;
+      kernel.advance(packCells(cells, width), middle, next, width, height);
+
+      executeGeneration(cells, conway);
+      executeGeneration(cells, conway);
+
+      THEN("The second generation should be the same") {
+        REQUIRE(next == packCells(cells, width));
+      }
+    }
+  }
+}
@@ -0,0 +1,89 @@
+/**
+ * @file test-WorkStealingScheduler.cpp
+ * @author Group 11
+ * @brief This file contains test cases to test the class
+ * WorkStealingScheduler
+ * @details These test cases will strive to ensure that every task is run
+ * exactly once, whichever worker runs it, and that the work is counted.
+ */
+
+#include <atomic>
+#include <vector>
+#include "Support/WorkStealingScheduler.h"
+#include "catch.hpp"
+
+//---------------------------------------------------------------------------
+/// @brief Tag used with CATCH to run test in this test file
+#define WORKSTEALING_TAG "[WorkStealingScheduler]"
+
+/**
+ * @brief Test that the tasks are run once and counted
+ * @details The tasks are uneven, all the slow tasks are handed to the first
+ * worker, so the other workers has to steal to finish early.
+ */
+SCENARIO("Tasks are run by a work stealing scheduler", WORKSTEALING_TAG) {
+  GIVEN("A scheduler on a pool with 3 workers and 100 tasks") {
+    ThreadPool pool(3);
+    WorkStealingScheduler scheduler(pool);
+    std::vector<size_t> tasks;
+    for (size_t task = 0; task < 100; task++)
+      tasks.push_back(task);
+
+    WHEN("The tasks are run twice") {
+      std::vector<std::atomic<int>> calls(100);
+      for (auto &count : calls)
+        count = 0;
+      for (int round = 0; round < 2; round++) {
+        scheduler.run(tasks, [&calls](size_t task) {
+          volatile long spin = 0;
+          for (long i = 0; i < (task < 34 ? 20000 : 10); i++)
+            spin = spin + i;
+          calls[task]++;
+        });
+      }
+
+      THEN("Every task should have run once each time") {
+        for (auto &count : calls)
+          REQUIRE(count == 2);
+      }
+      THEN("The tasks run by the workers should add up") {
+        unsigned long total = 0;
+        for (auto &stats : scheduler.getStats()) {
+          total += stats.tasks;
+          REQUIRE(stats.steals <= stats.tasks);
+          REQUIRE(stats.idleSeconds >= 0.0);
+        }
+        REQUIRE(scheduler.getStats().size() == 3);
+        REQUIRE(total == 200);
+      }
+    }
+
+    WHEN("The workers are placed on two nodes") {
+      scheduler.setWorkerNodes({0, 1, 0});
+      std::vector<std::atomic<int>> calls(100);
+      for (auto &count : calls)
+        count = 0;
+      bool workersKnown = true;
+      scheduler.run(tasks, [&](int worker, size_t task) {
+        if (worker < 0 || worker >= 3)
+          workersKnown = false;
+        calls[task]++;
+      });
+
+      THEN("Every task should have run once, by a known worker") {
+        for (auto &count : calls)
+          REQUIRE(count == 1);
+        REQUIRE(workersKnown);
+      }
+    }
+
+    WHEN("The stats are reset") {
+      scheduler.run(tasks, [](size_t) {});
+      scheduler.resetStats();
+      THEN("Every worker should have done nothing") {
+        for (auto &stats : scheduler.getStats())
+          REQUIRE(stats.tasks == 0);
+      }
+    }
+  }
+}
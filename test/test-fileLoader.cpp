@@ -47,24 +47,20 @@ SCENARIO("Test support function to create a new file for reading is called:",
  * @details In this scenarion the test is given an invalid filename. the
  * function should then correctly throw an exception and return an error message
  * to the user.
- * @bug As the variable "fileName" is a global variable. This test creates
- * issues in later tests as they will all print the error message "file not
- * found, closing application".
  */
 SCENARIO("Loading a population from an invalid file", FILELOADER_TAG) {
-  std::string oldFile = fileName;
   GIVEN("a Map holding cells") {
     map<Point, Cell> cells;
     WHEN("an invalid filename is entered:") {
-      fileName = "invalid.txt";
+      Dimensions dimensions;
       FileLoader fileloader;
       THEN("an exception should be thrown, with error message:") {
-        CHECK_THROWS_WITH(fileloader.loadPopulationFromFile(cells),
-                          "Could not find file. Closing application");
+        CHECK_THROWS_WITH(
+            fileloader.loadPopulationFromFile(cells, "invalid.txt", dimensions),
+            "Could not find file. Closing application");
       }
     }
   }
-  fileName = oldFile;
 }
 //---------------------------------------------------------------------------
 /**
@@ -77,20 +73,20 @@ SCENARIO(
     "Loading and building a population from a valid file created for the "
     "test.",
     FILELOADER_TAG) {
-  std::string oldFile = fileName;
   GIVEN("a Map holding cells and a file to read from (testFile.txt)") {
     CreateFileToRead("testFile.txt");
 
     map<Point, Cell> cells;
     WHEN("a valid filename is entered holding the dimensions 20x10") {
-      fileName = "testFile.txt";
+      Dimensions dimensions;
       FileLoader fileLoader;
-      fileLoader.loadPopulationFromFile(cells);
+      fileLoader.loadPopulationFromFile(cells, "testFile.txt", dimensions);
       THEN("A world with (height+2) * (width+2) dimensions is created") {
         REQUIRE(cells.size() == 264);
+        REQUIRE(dimensions.WIDTH == 20);
+        REQUIRE(dimensions.HEIGHT == 10);
       }
     }
   }
-  fileName = oldFile;
 }
 //---------------------------------------------------------------------------